@@ -0,0 +1,131 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#include "Benchmark.h"
+
+#include <Vsqlite/Allocator.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <thread>
+#include <optional>
+#include <cstdint>
+#include <cstddef>
+
+using namespace Vsqlite;
+using namespace Vsqlite::Benchmarks;
+
+namespace {
+
+    constexpr std::int64_t LookupRows = 100;
+    constexpr std::string_view PointQuery = "SELECT Value, Price, Name FROM Items WHERE Id = ?;";
+
+    /**
+     * Reinitializes SQLite with the given allocator, or with the system allocator if none,
+     * and with memory accounting disabled so that its global mutex does not hide the allocator.
+     * Restores the defaults on destruction.
+     */
+    class AllocatorScope {
+
+    private:
+        bool m_installed;
+
+    public:
+        explicit AllocatorScope(Allocator* pAllocator) : m_installed(pAllocator != nullptr) {
+
+            sqlite3_shutdown();
+
+            if (pAllocator) InstallAllocator(*pAllocator, false);
+            else sqlite3_config(SQLITE_CONFIG_MEMSTATUS, 0);
+
+        }
+
+        AllocatorScope(const AllocatorScope&) = delete;
+
+        virtual ~AllocatorScope(void) {
+
+            if (this->m_installed) UninstallAllocator();
+            else {
+                sqlite3_shutdown();
+                sqlite3_config(SQLITE_CONFIG_MEMSTATUS, 1);
+            }
+
+        }
+
+        AllocatorScope& operator= (const AllocatorScope&) = delete;
+
+    };
+
+    /**
+     * Runs GetIterations() prepare/bind/fetch/finalize cycles split across the given number of threads,
+     * each on its own in-memory database. Preparing a statement makes dozens of small allocations.
+     */
+    void PrepareAndFetch(State& state, const std::size_t threads, Allocator* pAllocator) {
+
+        const AllocatorScope scope = AllocatorScope(pAllocator);
+
+        std::vector<std::thread> workers = { };
+        workers.reserve(threads);
+
+        state.Start();
+
+        for (std::size_t t = 0; t < threads; ++t) {
+            const std::uint64_t count = ((state.GetIterations() / threads) + ((t < (state.GetIterations() % threads)) ? 1 : 0));
+            workers.emplace_back([count] () {
+
+                Database db = { std::nullopt, (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_MEMORY) };
+                CreateItems(db, LookupRows);
+
+                std::int64_t value = 0;
+                double price = 0.0;
+                std::string name = { };
+
+                for (std::uint64_t i = 0; i < count; ++i) {
+                    Statement s = db.PrepareStatement(PointQuery, 0);
+                    s.Bind(static_cast<std::int64_t>((i % LookupRows) + 1));
+                    if (s.Fetch(value, price, name)) DoNotOptimize(name);
+                }
+
+            });
+        }
+
+        for (std::thread& worker : workers) worker.join();
+
+        state.Stop();
+
+    }
+
+    void PrepareAndFetchPooled(State& state, const std::size_t threads) {
+        PoolAllocator allocator = PoolAllocator();
+        PrepareAndFetch(state, threads, &allocator);
+    }
+
+}
+
+VSQLITE_BENCHMARK(AllocatorSystem1Thread) {
+    PrepareAndFetch(state, 1, nullptr);
+}
+
+VSQLITE_BENCHMARK(AllocatorPool1Thread) {
+    PrepareAndFetchPooled(state, 1);
+}
+
+VSQLITE_BENCHMARK(AllocatorSystem4Threads) {
+    PrepareAndFetch(state, 4, nullptr);
+}
+
+VSQLITE_BENCHMARK(AllocatorPool4Threads) {
+    PrepareAndFetchPooled(state, 4);
+}
+
+VSQLITE_BENCHMARK(AllocatorSystem8Threads) {
+    PrepareAndFetch(state, 8, nullptr);
+}
+
+VSQLITE_BENCHMARK(AllocatorPool8Threads) {
+    PrepareAndFetchPooled(state, 8);
+}
\ No newline at end of file
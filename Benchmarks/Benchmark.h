@@ -0,0 +1,243 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#ifndef _VSQLITE_BENCHMARKS_BENCHMARK_H_
+#define _VSQLITE_BENCHMARKS_BENCHMARK_H_
+
+#include <Vsqlite/Database.h>
+#include <Vsqlite/Statement.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <chrono>
+#include <filesystem>
+#include <system_error>
+#include <cstdint>
+
+namespace Vsqlite::Benchmarks {
+
+    /**
+     * Timing state of a single benchmark run.
+     *
+     * A benchmark performs its setup, then either loops with KeepRunning,
+     * or calls Start, performs GetIterations() operations and calls Stop.
+     */
+    class State {
+
+    private:
+        std::uint64_t m_iterations;
+        std::uint64_t m_remaining;
+        std::uint64_t m_itemsPerIteration;
+        std::chrono::steady_clock::time_point m_start;
+        std::chrono::nanoseconds m_elapsed;
+        bool m_running;
+
+    public:
+        explicit State(const std::uint64_t iterations);
+
+        /**
+         * Returns the number of operations the benchmark must perform.
+         *
+         * @returns An integer.
+         */
+        std::uint64_t GetIterations(void) const;
+
+        /**
+         * Sets the number of items (rows, queries, ...) processed by one operation.
+         *
+         * @param items Number of items.
+         */
+        void SetItemsPerIteration(const std::uint64_t items);
+
+        std::uint64_t GetItemsPerIteration(void) const;
+
+        /**
+         * Starts the timer.
+         */
+        void Start(void);
+
+        /**
+         * Stops the timer.
+         */
+        void Stop(void);
+
+        /**
+         * Starts the timer on the first call and stops it once all iterations have run.
+         *
+         * @returns true if another operation must be performed; otherwise, false.
+         */
+        bool KeepRunning(void);
+
+        std::chrono::nanoseconds GetElapsed(void) const;
+
+    };
+
+    using BenchmarkFunction = void (*)(State&);
+
+    struct BenchmarkInfo {
+        std::string_view Name;
+        BenchmarkFunction Function;
+    };
+
+    /**
+     * Returns the registered benchmarks, in registration order.
+     *
+     * @returns A vector of BenchmarkInfo.
+     */
+    std::vector<BenchmarkInfo>& GetRegistry(void);
+
+    /**
+     * Registers a benchmark.
+     *
+     * @param name Benchmark name.
+     * @param function Benchmark function.
+     * @returns true.
+     */
+    bool Register(const std::string_view name, const BenchmarkFunction function);
+
+    /**
+     * Represents a database file in the temporary directory that is deleted,
+     * together with its journal files, on construction and destruction.
+     */
+    class TemporaryFile {
+
+    private:
+        std::filesystem::path m_path;
+
+        void Remove(void) const;
+
+    public:
+        explicit TemporaryFile(const std::string_view name);
+
+        TemporaryFile(const TemporaryFile&) = delete;
+        virtual ~TemporaryFile(void);
+
+        TemporaryFile& operator= (const TemporaryFile&) = delete;
+
+        std::string GetPath(void) const;
+
+    };
+
+    /**
+     * Creates table Items(Id INTEGER PRIMARY KEY, Value INTEGER, Price REAL, Name TEXT)
+     * and fills it with the given number of rows.
+     *
+     * @param database An SQLite database.
+     * @param rows Number of rows.
+     */
+    void CreateItems(Database& database, const std::int64_t rows);
+
+    /**
+     * Prevents the compiler from optimizing away a value.
+     */
+    template <typename T>
+    inline void DoNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile ("" : : "r,m" (value) : "memory");
+#else
+        static const void* volatile pSink = nullptr;
+        pSink = &value;
+#endif
+    }
+
+    inline State::State(const std::uint64_t iterations)
+        : m_iterations(iterations), m_remaining(iterations), m_itemsPerIteration(1), m_start(), m_elapsed(0), m_running(false) { }
+
+    inline std::uint64_t State::GetIterations() const {
+        return this->m_iterations;
+    }
+
+    inline void State::SetItemsPerIteration(const std::uint64_t items) {
+        this->m_itemsPerIteration = items;
+    }
+
+    inline std::uint64_t State::GetItemsPerIteration() const {
+        return this->m_itemsPerIteration;
+    }
+
+    inline void State::Start() {
+        this->m_running = true;
+        this->m_start = std::chrono::steady_clock::now();
+    }
+
+    inline void State::Stop() {
+        this->m_elapsed += (std::chrono::steady_clock::now() - this->m_start);
+        this->m_running = false;
+    }
+
+    inline bool State::KeepRunning() {
+
+        if ((this->m_remaining == this->m_iterations) && !this->m_running) this->Start();
+
+        if (this->m_remaining == 0) {
+            if (this->m_running) this->Stop();
+            return false;
+        }
+
+        --this->m_remaining;
+        return true;
+    }
+
+    inline std::chrono::nanoseconds State::GetElapsed() const {
+        return this->m_elapsed;
+    }
+
+    inline std::vector<BenchmarkInfo>& GetRegistry() {
+        static std::vector<BenchmarkInfo> registry = { };
+        return registry;
+    }
+
+    inline bool Register(const std::string_view name, const BenchmarkFunction function) {
+        GetRegistry().push_back({ name, function });
+        return true;
+    }
+
+    inline TemporaryFile::TemporaryFile(const std::string_view name)
+        : m_path(std::filesystem::temp_directory_path() / ("vsqlite_" + std::string(name) + ".db")) {
+        this->Remove();
+    }
+
+    inline TemporaryFile::~TemporaryFile() {
+        this->Remove();
+    }
+
+    inline void TemporaryFile::Remove() const {
+        std::error_code ec = { };
+        for (const char* suffix : { "", "-journal", "-wal", "-shm" })
+            std::filesystem::remove((this->m_path.string() + suffix), ec);
+    }
+
+    inline std::string TemporaryFile::GetPath() const {
+        return this->m_path.string();
+    }
+
+    inline void CreateItems(Database& database, const std::int64_t rows) {
+
+        database.Execute("CREATE TABLE Items(Id INTEGER PRIMARY KEY, Value INTEGER NOT NULL, Price REAL NOT NULL, Name TEXT NOT NULL);");
+        database.Execute("BEGIN;");
+
+        Statement insert = database.PrepareStatement("INSERT INTO Items VALUES (?, ?, ?, ?);", SQLITE_PREPARE_PERSISTENT);
+        for (std::int64_t i = 1; i <= rows; ++i)
+            insert.Execute(i, (i * 7919) % 1000, (i * 0.25), ("item-" + std::to_string(i)));
+
+        database.Execute("COMMIT;");
+
+    }
+
+}
+
+/**
+ * Defines and registers a benchmark function.
+ *
+ * @param name Benchmark name.
+ */
+#define VSQLITE_BENCHMARK(name)                                                                             \
+    static void name(Vsqlite::Benchmarks::State& state);                                                    \
+    static const bool name##Registered = Vsqlite::Benchmarks::Register(#name, &name);                       \
+    static void name([[maybe_unused]] Vsqlite::Benchmarks::State& state)
+
+#endif // _VSQLITE_BENCHMARKS_BENCHMARK_H_
\ No newline at end of file
@@ -0,0 +1,104 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#include "Benchmark.h"
+
+#include <Vsqlite/StatementCache.h>
+#include <Vsqlite/ConnectionPool.h>
+#include <Vsqlite/QueryProfiler.h>
+
+#include <string_view>
+#include <vector>
+#include <thread>
+#include <cstdint>
+#include <cstddef>
+
+using namespace Vsqlite;
+using namespace Vsqlite::Benchmarks;
+
+namespace {
+
+    constexpr std::int64_t LookupRows = 10'000;
+    constexpr std::string_view PointQuery = "SELECT Value, Price, Name FROM Items WHERE Id = ?;";
+
+    /**
+     * Runs GetIterations() point lookups split across the given number of threads,
+     * each using its own reader from a ConnectionPool.
+     */
+    void PooledLookups(State& state, const std::size_t threads) {
+
+        const TemporaryFile file = TemporaryFile("pool_reads");
+
+        ConnectionPoolOptions options = { };
+        options.Readers = threads;
+        ConnectionPool pool = { file.GetPath(), options };
+
+        {
+            ConnectionLease writer = pool.AcquireWriter();
+            CreateItems(*writer, LookupRows);
+        }
+
+        std::vector<std::thread> workers = { };
+        workers.reserve(threads);
+
+        state.Start();
+
+        for (std::size_t t = 0; t < threads; ++t) {
+            const std::uint64_t count = ((state.GetIterations() / threads) + ((t < (state.GetIterations() % threads)) ? 1 : 0));
+            workers.emplace_back([&pool, count, t] () {
+
+                ConnectionLease reader = pool.AcquireReader();
+                std::int64_t value = 0;
+
+                for (std::uint64_t i = 0; i < count; ++i) {
+                    CachedStatement s = reader->Cached(PointQuery);
+                    s->Bind(static_cast<std::int64_t>(((i * 31 + t) % LookupRows) + 1));
+                    if (s->Fetch(value)) DoNotOptimize(value);
+                }
+
+            });
+        }
+
+        for (std::thread& worker : workers) worker.join();
+
+        state.Stop();
+
+    }
+
+}
+
+VSQLITE_BENCHMARK(PoolReads1Thread) {
+    PooledLookups(state, 1);
+}
+
+VSQLITE_BENCHMARK(PoolReads2Threads) {
+    PooledLookups(state, 2);
+}
+
+VSQLITE_BENCHMARK(PoolReads4Threads) {
+    PooledLookups(state, 4);
+}
+
+VSQLITE_BENCHMARK(PoolReads8Threads) {
+    PooledLookups(state, 8);
+}
+
+VSQLITE_BENCHMARK(PointLookupProfiled) {
+
+    Database db = { std::nullopt, (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_MEMORY) };
+    CreateItems(db, LookupRows);
+    db.EnableProfiling();
+
+    std::int64_t id = 0;
+    std::int64_t value = 0;
+
+    while (state.KeepRunning()) {
+        CachedStatement s = db.Cached(PointQuery);
+        s->Bind((id++ % LookupRows) + 1);
+        if (s->Fetch(value)) DoNotOptimize(value);
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#include "Benchmark.h"
+
+#include <Vsqlite/DatabaseImage.h>
+
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+using namespace Vsqlite;
+using namespace Vsqlite::Benchmarks;
+
+namespace {
+
+    constexpr std::int64_t ImageRows = 200'000;
+
+    /**
+     * Returns the path of a reference database, created on first use and deleted at exit.
+     */
+    const TemporaryFile& GetReferenceFile(void) {
+
+        static const TemporaryFile file = TemporaryFile("image_reference");
+        static const bool created = [] () {
+            Database db = { file.GetPath(), (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+            CreateItems(db, ImageRows);
+            return true;
+        }();
+
+        static_cast<void>(created);
+        return file;
+    }
+
+    /**
+     * Runs the first query of a freshly opened database: a scan that reads every page.
+     * The operating system's file cache is warm after the first iteration, so this measures
+     * open and first-query cost without disk latency.
+     */
+    void FirstQuery(Database& db) {
+        std::int64_t sum = 0;
+        db.Execute("SELECT sum(Value) FROM Items;").Fetch(sum);
+        DoNotOptimize(sum);
+    }
+
+    void OpenImageFirstQuery(State& state, const ImageLoadMode mode, const std::size_t prefetchThreads) {
+
+        const TemporaryFile& file = GetReferenceFile();
+        state.SetItemsPerIteration(ImageRows);
+
+        ImageOptions options = { };
+        options.Mode = mode;
+        options.PrefetchThreads = prefetchThreads;
+
+        while (state.KeepRunning()) {
+            Database db = Database::OpenImage(file.GetPath(), options);
+            FirstQuery(db);
+        }
+
+    }
+
+}
+
+VSQLITE_BENCHMARK(OpenPlainFirstQuery) {
+
+    const TemporaryFile& file = GetReferenceFile();
+    state.SetItemsPerIteration(ImageRows);
+
+    while (state.KeepRunning()) {
+        Database db = { file.GetPath(), SQLITE_OPEN_READONLY };
+        FirstQuery(db);
+    }
+
+}
+
+VSQLITE_BENCHMARK(OpenImageMapFirstQuery) {
+    OpenImageFirstQuery(state, ImageLoadMode::Map, 0);
+}
+
+VSQLITE_BENCHMARK(OpenImageMapPrefetchFirstQuery) {
+    OpenImageFirstQuery(state, ImageLoadMode::Map, 4);
+}
+
+VSQLITE_BENCHMARK(OpenImageReadFirstQuery) {
+    OpenImageFirstQuery(state, ImageLoadMode::Read, 0);
+}
\ No newline at end of file
@@ -0,0 +1,121 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#include "Benchmark.h"
+
+#include <Vsqlite/DatabaseOptions.h>
+#include <Vsqlite/StatementCache.h>
+#include <Vsqlite/BulkInserter.h>
+#include <Vsqlite/Transaction.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <tuple>
+#include <cstdint>
+
+using namespace Vsqlite;
+using namespace Vsqlite::Benchmarks;
+
+namespace {
+
+    constexpr std::string_view InsertSql = "INSERT INTO Items (Value, Price, Name) VALUES (?, ?, ?);";
+
+    Database OpenItems(const TemporaryFile& file, const DatabaseOptions& options = { }) {
+        Database db = { file.GetPath(), (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE), options };
+        CreateItems(db, 0);
+        return db;
+    }
+
+    /**
+     * Inserts one row per iteration, each in its own transaction, so that the
+     * journal and synchronous settings of the profile dominate.
+     */
+    void InsertEachRow(State& state, const std::string_view name, const DatabaseOptions& options) {
+
+        const TemporaryFile file = TemporaryFile(name);
+        Database db = OpenItems(file, options);
+        Statement s = db.PrepareStatement(InsertSql, SQLITE_PREPARE_PERSISTENT);
+        std::int64_t i = 0;
+
+        while (state.KeepRunning()) {
+            s.ExecuteRebind(i, (i * 0.25), "item");
+            ++i;
+        }
+
+    }
+
+}
+
+VSQLITE_BENCHMARK(InsertAutocommit) {
+    InsertEachRow(state, "insert_autocommit", { });
+}
+
+VSQLITE_BENCHMARK(InsertAutocommitWriteHeavy) {
+    InsertEachRow(state, "insert_autocommit_write_heavy", DatabaseOptions::WriteHeavy());
+}
+
+VSQLITE_BENCHMARK(InsertAutocommitReadMostly) {
+    InsertEachRow(state, "insert_autocommit_read_mostly", DatabaseOptions::ReadMostly());
+}
+
+VSQLITE_BENCHMARK(InsertAutocommitEphemeral) {
+    InsertEachRow(state, "insert_autocommit_ephemeral", DatabaseOptions::Ephemeral());
+}
+
+VSQLITE_BENCHMARK(InsertAutocommitBulkLoad) {
+    InsertEachRow(state, "insert_autocommit_bulk_load", DatabaseOptions::BulkLoad());
+}
+
+VSQLITE_BENCHMARK(InsertTransaction) {
+
+    const TemporaryFile file = TemporaryFile("insert_transaction");
+    Database db = OpenItems(file);
+    Statement s = db.PrepareStatement(InsertSql, SQLITE_PREPARE_PERSISTENT);
+
+    state.Start();
+
+    Transaction transaction = { db, TransactionMode::Immediate };
+    for (std::uint64_t i = 0; i < state.GetIterations(); ++i)
+        s.ExecuteRebind(static_cast<std::int64_t>(i), (i * 0.25), "item");
+    transaction.Commit();
+
+    state.Stop();
+
+}
+
+VSQLITE_BENCHMARK(InsertBulkInserter) {
+
+    const TemporaryFile file = TemporaryFile("insert_bulk");
+    Database db = OpenItems(file);
+
+    state.Start();
+
+    {
+        BulkInserter inserter = { db, InsertSql };
+        for (std::uint64_t i = 0; i < state.GetIterations(); ++i)
+            inserter.Insert(static_cast<std::int64_t>(i), (i * 0.25), "item");
+    }
+
+    state.Stop();
+
+}
+
+VSQLITE_BENCHMARK(InsertMany) {
+
+    const TemporaryFile file = TemporaryFile("insert_many");
+    Database db = OpenItems(file);
+
+    std::vector<std::tuple<std::int64_t, double, std::string>> rows = { };
+    rows.reserve(state.GetIterations());
+    for (std::uint64_t i = 0; i < state.GetIterations(); ++i)
+        rows.emplace_back(static_cast<std::int64_t>(i), (i * 0.25), "item");
+
+    state.Start();
+    db.InsertMany(InsertSql, rows);
+    state.Stop();
+
+}
\ No newline at end of file
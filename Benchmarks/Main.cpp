@@ -0,0 +1,92 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#include "Benchmark.h"
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <chrono>
+#include <algorithm>
+#include <exception>
+#include <cstdio>
+#include <cstdint>
+
+using namespace Vsqlite::Benchmarks;
+
+static void PrintUsage(const char* program) {
+    std::cout << "Usage: " << program << " [--filter=<substring>] [--min-time=<ms>] [--list]" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+
+    std::string_view filter = { };
+    std::chrono::milliseconds minTime = std::chrono::milliseconds(200);
+    bool list = false;
+
+    for (int i = 1; i < argc; ++i) {
+
+        const std::string_view arg = argv[i];
+
+        if (arg.starts_with("--filter=")) filter = arg.substr(9);
+        else if (arg.starts_with("--min-time=")) minTime = std::chrono::milliseconds(std::stoll(std::string(arg.substr(11))));
+        else if (arg == "--list") list = true;
+        else {
+            PrintUsage(argv[0]);
+            return ((arg == "--help") ? 0 : 1);
+        }
+
+    }
+
+    std::printf("%-40s %12s %14s %16s\n", "Benchmark", "Iterations", "ns/op", "items/s");
+
+    for (const BenchmarkInfo& benchmark : GetRegistry()) {
+
+        if (!filter.empty() && (benchmark.Name.find(filter) == std::string_view::npos)) continue;
+
+        if (list) {
+            std::cout << benchmark.Name << std::endl;
+            continue;
+        }
+
+        try {
+
+            std::uint64_t iterations = 1;
+
+            while (true) {
+
+                State state = State(iterations);
+                benchmark.Function(state);
+
+                const std::chrono::nanoseconds elapsed = state.GetElapsed();
+                if ((elapsed >= minTime) || (iterations >= 1'000'000'000)) {
+
+                    const double nsPerOp = (static_cast<double>(elapsed.count()) / iterations);
+                    const double itemsPerSecond = ((iterations * state.GetItemsPerIteration()) / (elapsed.count() / 1e9));
+
+                    std::printf("%-40.*s %12llu %14.1f %16.0f\n", static_cast<int>(benchmark.Name.length()), benchmark.Name.data(),
+                        static_cast<unsigned long long>(iterations), nsPerOp, itemsPerSecond);
+                    std::fflush(stdout);
+
+                    break;
+                }
+
+                // Aim for 1.5x the minimum time, growing by at most 10x per round.
+                const double scale = ((elapsed.count() > 0) ? ((minTime.count() * 1.5e6) / elapsed.count()) : 10.0);
+                iterations = static_cast<std::uint64_t>(iterations * std::clamp(scale, 2.0, 10.0));
+
+            }
+
+        }
+        catch (const std::exception& ex) {
+            std::printf("%-40.*s failed: %s\n", static_cast<int>(benchmark.Name.length()), benchmark.Name.data(), ex.what());
+            return 1;
+        }
+
+    }
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,97 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#include "Benchmark.h"
+
+#include <Vsqlite/ConnectionPool.h>
+#include <Vsqlite/ParallelQuery.h>
+
+#include <map>
+#include <cstdint>
+#include <cstddef>
+
+using namespace Vsqlite;
+using namespace Vsqlite::Benchmarks;
+
+namespace {
+
+    constexpr std::int64_t ScanRows = 500'000;
+
+    using Groups = std::map<std::int64_t, double>;
+
+    /**
+     * Returns the path of a WAL database with ScanRows items, created on first use and deleted at exit.
+     */
+    const TemporaryFile& GetScanFile(void) {
+
+        static const TemporaryFile file = TemporaryFile("parallel_scan");
+        static const bool created = [] () {
+            ConnectionPool pool = { file.GetPath(), { } };
+            ConnectionLease writer = pool.AcquireWriter();
+            CreateItems(*writer, ScanRows);
+            return true;
+        }();
+
+        static_cast<void>(created);
+        return file;
+    }
+
+    /**
+     * Runs a grouped aggregate over every row, split by rowid into the given number of partitions.
+     * With one partition, this is the serial query on a single connection.
+     */
+    void PartitionedScan(State& state, const std::size_t partitions) {
+
+        const TemporaryFile& file = GetScanFile();
+        state.SetItemsPerIteration(ScanRows);
+
+        ConnectionPoolOptions options = { };
+        options.Readers = partitions;
+        ConnectionPool pool = { file.GetPath(), options };
+
+        ParallelQuery query = { pool, "SELECT Value % 16, sum(Price) FROM Items WHERE rowid BETWEEN ?1 AND ?2 GROUP BY 1;" };
+        query.ByRowid("Items");
+
+        while (state.KeepRunning()) {
+
+            const Groups groups = query.Run(
+                Groups { },
+                [] (Statement& s) {
+                    Groups partial = { };
+                    std::int64_t group = 0;
+                    double sum = 0.00;
+                    while (s.Fetch(group, sum)) partial[group] += sum;
+                    return partial;
+                },
+                [] (Groups result, const Groups& partial) {
+                    for (const auto& [group, sum] : partial) result[group] += sum;
+                    return result;
+                }
+            );
+
+            DoNotOptimize(groups);
+
+        }
+
+    }
+
+}
+
+VSQLITE_BENCHMARK(ParallelScan1Partition) {
+    PartitionedScan(state, 1);
+}
+
+VSQLITE_BENCHMARK(ParallelScan2Partitions) {
+    PartitionedScan(state, 2);
+}
+
+VSQLITE_BENCHMARK(ParallelScan4Partitions) {
+    PartitionedScan(state, 4);
+}
+
+VSQLITE_BENCHMARK(ParallelScan8Partitions) {
+    PartitionedScan(state, 8);
+}
\ No newline at end of file
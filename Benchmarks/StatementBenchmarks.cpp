@@ -0,0 +1,347 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#include "Benchmark.h"
+
+#include <Vsqlite/StatementCache.h>
+#include <Vsqlite/RowRange.h>
+#include <Vsqlite/ColumnBuffers.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <span>
+#include <optional>
+#include <cstdint>
+#include <cstddef>
+
+using namespace Vsqlite;
+using namespace Vsqlite::Benchmarks;
+
+namespace {
+
+    constexpr std::int64_t ItemRows = 10'000;
+    constexpr std::size_t BatchSize = 1024;
+    constexpr std::string_view PointQuery = "SELECT Value, Price, Name FROM Items WHERE Id = ?;";
+
+    Database OpenMemory(void) {
+        return Database(std::nullopt, (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_MEMORY));
+    }
+
+    /**
+     * Binds a value to "SELECT ?", steps and reads the column back, once per iteration.
+     */
+    template <typename T>
+    void RoundTrip(State& state, const T& value) {
+
+        Database db = OpenMemory();
+        Statement s = db.PrepareStatement("SELECT ?;", SQLITE_PREPARE_PERSISTENT);
+        T out = { };
+
+        while (state.KeepRunning()) {
+            s.ExecuteRebind(value);
+            s.Fetch(out);
+            DoNotOptimize(out);
+        }
+
+    }
+
+}
+
+// Prepare cost
+
+VSQLITE_BENCHMARK(PrepareRaw) {
+
+    Database db = OpenMemory();
+    CreateItems(db, 1);
+
+    while (state.KeepRunning()) {
+        sqlite3_stmt* pStatement = nullptr;
+        sqlite3_prepare_v3(db.GetDatabaseHandle(), PointQuery.data(), static_cast<int>(PointQuery.length()), 0, &pStatement, nullptr);
+        sqlite3_finalize(pStatement);
+    }
+
+}
+
+VSQLITE_BENCHMARK(PrepareStatement) {
+
+    Database db = OpenMemory();
+    CreateItems(db, 1);
+
+    while (state.KeepRunning()) {
+        Statement s = db.PrepareStatement(PointQuery, 0);
+        DoNotOptimize(s);
+    }
+
+}
+
+VSQLITE_BENCHMARK(PrepareCached) {
+
+    Database db = OpenMemory();
+    CreateItems(db, 1);
+
+    while (state.KeepRunning()) {
+        CachedStatement s = db.Cached(PointQuery);
+        DoNotOptimize(s);
+    }
+
+}
+
+// Bind/step/column per DataBinding type
+
+VSQLITE_BENCHMARK(RoundTripRaw) {
+
+    Database db = OpenMemory();
+    sqlite3_stmt* pStatement = nullptr;
+    sqlite3_prepare_v3(db.GetDatabaseHandle(), "SELECT ?;", -1, SQLITE_PREPARE_PERSISTENT, &pStatement, nullptr);
+
+    while (state.KeepRunning()) {
+        sqlite3_reset(pStatement);
+        sqlite3_bind_int64(pStatement, 1, 42);
+        sqlite3_step(pStatement);
+        DoNotOptimize(sqlite3_column_int64(pStatement, 0));
+    }
+
+    sqlite3_finalize(pStatement);
+
+}
+
+VSQLITE_BENCHMARK(RoundTripInt32) {
+    RoundTrip<std::int32_t>(state, 42);
+}
+
+VSQLITE_BENCHMARK(RoundTripInt64) {
+    RoundTrip<std::int64_t>(state, 42);
+}
+
+VSQLITE_BENCHMARK(RoundTripDouble) {
+    RoundTrip<double>(state, 42.5);
+}
+
+VSQLITE_BENCHMARK(RoundTripOptionalInt64) {
+    RoundTrip<std::optional<std::int64_t>>(state, 42);
+}
+
+VSQLITE_BENCHMARK(RoundTripStringShort) {
+    RoundTrip<std::string>(state, std::string("vsqlite"));
+}
+
+VSQLITE_BENCHMARK(RoundTripStringLong) {
+    RoundTrip<std::string>(state, std::string(4096, 'x'));
+}
+
+VSQLITE_BENCHMARK(RoundTripStringBorrowed) {
+
+    Database db = OpenMemory();
+    Statement s = db.PrepareStatement("SELECT ?;", SQLITE_PREPARE_PERSISTENT);
+    const std::string value = std::string(4096, 'x');
+    std::string_view out = { };
+
+    while (state.KeepRunning()) {
+        s.ExecuteRebind(Borrowed(value));
+        s.Fetch(out);
+        DoNotOptimize(out);
+    }
+
+}
+
+VSQLITE_BENCHMARK(RoundTripBlobVector) {
+    RoundTrip<std::vector<std::byte>>(state, std::vector<std::byte>(4096, std::byte(0x5A)));
+}
+
+VSQLITE_BENCHMARK(RoundTripBlobSpan) {
+
+    Database db = OpenMemory();
+    Statement s = db.PrepareStatement("SELECT ?;", SQLITE_PREPARE_PERSISTENT);
+    const std::vector<std::byte> value = std::vector<std::byte>(4096, std::byte(0x5A));
+    std::span<const std::byte> out = { };
+
+    while (state.KeepRunning()) {
+        s.ExecuteRebind(std::span<const std::byte>(value));
+        s.Fetch(out);
+        DoNotOptimize(out);
+    }
+
+}
+
+// Execute vs. ExecuteRebind
+
+VSQLITE_BENCHMARK(ExecuteUnbind) {
+
+    Database db = OpenMemory();
+    Statement s = db.PrepareStatement("SELECT ?, ?, ?;", SQLITE_PREPARE_PERSISTENT);
+
+    while (state.KeepRunning())
+        s.Execute(1, 2.5, "three");
+
+}
+
+VSQLITE_BENCHMARK(ExecuteRebind) {
+
+    Database db = OpenMemory();
+    Statement s = db.PrepareStatement("SELECT ?, ?, ?;", SQLITE_PREPARE_PERSISTENT);
+
+    while (state.KeepRunning())
+        s.ExecuteRebind(1, 2.5, "three");
+
+}
+
+// Scans: raw sqlite3 vs. Fetch vs. Rows vs. FetchBatch
+
+VSQLITE_BENCHMARK(ScanRaw) {
+
+    Database db = OpenMemory();
+    CreateItems(db, ItemRows);
+    state.SetItemsPerIteration(ItemRows);
+
+    sqlite3_stmt* pStatement = nullptr;
+    sqlite3_prepare_v3(db.GetDatabaseHandle(), "SELECT Value, Price, Name FROM Items;", -1, SQLITE_PREPARE_PERSISTENT, &pStatement, nullptr);
+
+    while (state.KeepRunning()) {
+
+        sqlite3_reset(pStatement);
+
+        while (sqlite3_step(pStatement) == SQLITE_ROW) {
+            DoNotOptimize(sqlite3_column_int64(pStatement, 0));
+            DoNotOptimize(sqlite3_column_double(pStatement, 1));
+            const unsigned char* pText = sqlite3_column_text(pStatement, 2);
+            DoNotOptimize(std::string_view(reinterpret_cast<const char*>(pText), sqlite3_column_bytes(pStatement, 2)));
+        }
+
+    }
+
+    sqlite3_finalize(pStatement);
+
+}
+
+VSQLITE_BENCHMARK(ScanFetch) {
+
+    Database db = OpenMemory();
+    CreateItems(db, ItemRows);
+    state.SetItemsPerIteration(ItemRows);
+
+    Statement s = db.PrepareStatement("SELECT Value, Price, Name FROM Items;", SQLITE_PREPARE_PERSISTENT);
+    std::int64_t value = 0;
+    double price = 0.0;
+    std::string_view name = { };
+
+    while (state.KeepRunning()) {
+
+        s.Reset();
+
+        while (s.Fetch(value, price, name)) {
+            DoNotOptimize(value);
+            DoNotOptimize(price);
+            DoNotOptimize(name);
+        }
+
+    }
+
+}
+
+VSQLITE_BENCHMARK(ScanFetchString) {
+
+    Database db = OpenMemory();
+    CreateItems(db, ItemRows);
+    state.SetItemsPerIteration(ItemRows);
+
+    Statement s = db.PrepareStatement("SELECT Value, Price, Name FROM Items;", SQLITE_PREPARE_PERSISTENT);
+    std::int64_t value = 0;
+    double price = 0.0;
+    std::string name = { };
+
+    while (state.KeepRunning()) {
+
+        s.Reset();
+
+        while (s.Fetch(value, price, name)) {
+            DoNotOptimize(value);
+            DoNotOptimize(price);
+            DoNotOptimize(name);
+        }
+
+    }
+
+}
+
+VSQLITE_BENCHMARK(ScanRows) {
+
+    Database db = OpenMemory();
+    CreateItems(db, ItemRows);
+    state.SetItemsPerIteration(ItemRows);
+
+    Statement s = db.PrepareStatement("SELECT Value, Price, Name FROM Items;", SQLITE_PREPARE_PERSISTENT);
+
+    while (state.KeepRunning()) {
+
+        s.Reset();
+
+        for (const auto& [value, price, name] : s.Rows<std::int64_t, double, std::string_view>()) {
+            DoNotOptimize(value);
+            DoNotOptimize(price);
+            DoNotOptimize(name);
+        }
+
+    }
+
+}
+
+VSQLITE_BENCHMARK(ScanFetchBatch) {
+
+    Database db = OpenMemory();
+    CreateItems(db, ItemRows);
+    state.SetItemsPerIteration(ItemRows);
+
+    Statement s = db.PrepareStatement("SELECT Value, Price, Name FROM Items;", SQLITE_PREPARE_PERSISTENT);
+    ColumnBuffers<std::int64_t, double, std::string> buffers = { };
+
+    while (state.KeepRunning()) {
+
+        s.Reset();
+
+        while (s.FetchBatch(BatchSize, buffers) != 0)
+            DoNotOptimize(buffers.GetColumn<0>().data());
+
+    }
+
+}
+
+// Point lookups: raw sqlite3 vs. cached statement
+
+VSQLITE_BENCHMARK(PointLookupRaw) {
+
+    Database db = OpenMemory();
+    CreateItems(db, ItemRows);
+
+    sqlite3_stmt* pStatement = nullptr;
+    sqlite3_prepare_v3(db.GetDatabaseHandle(), PointQuery.data(), static_cast<int>(PointQuery.length()), SQLITE_PREPARE_PERSISTENT, &pStatement, nullptr);
+    std::int64_t id = 0;
+
+    while (state.KeepRunning()) {
+        sqlite3_reset(pStatement);
+        sqlite3_bind_int64(pStatement, 1, ((id++ % ItemRows) + 1));
+        if (sqlite3_step(pStatement) == SQLITE_ROW) DoNotOptimize(sqlite3_column_int64(pStatement, 0));
+    }
+
+    sqlite3_finalize(pStatement);
+
+}
+
+VSQLITE_BENCHMARK(PointLookupCached) {
+
+    Database db = OpenMemory();
+    CreateItems(db, ItemRows);
+
+    std::int64_t id = 0;
+    std::int64_t value = 0;
+
+    while (state.KeepRunning()) {
+        CachedStatement s = db.Cached(PointQuery);
+        s->Bind((id++ % ItemRows) + 1);
+        if (s->Fetch(value)) DoNotOptimize(value);
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,769 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#ifndef _VSQLITE_ALLOCATOR_H_
+#define _VSQLITE_ALLOCATOR_H_
+
+#include <Vsqlite/SQLite.h>
+#include <Vsqlite/SqliteException.h>
+
+#include <array>
+#include <vector>
+#include <memory>
+#include <unordered_set>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <functional>
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <stdexcept>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+namespace Vsqlite {
+
+    /**
+     * Represents a memory allocator that SQLite can use for all of its allocations.
+     *
+     * Implementations must be thread-safe and return memory aligned to at least 8 bytes.
+     */
+    class Allocator {
+
+    public:
+        virtual ~Allocator(void) = default;
+
+        /**
+         * Allocates memory.
+         *
+         * @param size Number of bytes.
+         * @returns A pointer to the memory, or nullptr if the allocation failed.
+         */
+        virtual void* Allocate(const std::size_t size) = 0;
+
+        /**
+         * Frees memory returned by Allocate or Reallocate.
+         *
+         * @param pMemory A pointer to the memory, or nullptr.
+         */
+        virtual void Free(void* const pMemory) noexcept = 0;
+
+        /**
+         * Resizes memory returned by Allocate or Reallocate.
+         *
+         * @param pMemory A pointer to the memory.
+         * @param size New number of bytes.
+         * @returns A pointer to the resized memory, or nullptr if the allocation failed,
+         * in which case the original memory is left untouched.
+         */
+        virtual void* Reallocate(void* const pMemory, const std::size_t size) = 0;
+
+        /**
+         * Returns the usable size of memory returned by Allocate or Reallocate.
+         *
+         * @param pMemory A pointer to the memory.
+         * @returns Number of bytes.
+         */
+        virtual std::size_t GetSize(void* const pMemory) const noexcept = 0;
+
+        /**
+         * Returns the number of bytes Allocate would actually provide for a request.
+         *
+         * @param size Number of bytes.
+         * @returns Number of bytes.
+         */
+        virtual std::size_t RoundUp(const std::size_t size) const noexcept;
+
+    };
+
+    /**
+     * PoolAllocator counters.
+     */
+    struct AllocatorStatistics {
+        std::uint64_t Allocations;
+        std::uint64_t Frees;
+        std::uint64_t Reallocations;
+        std::uint64_t LargeAllocations;
+        std::uint64_t CentralTransfers;
+        std::uint64_t Chunks;
+        std::int64_t BytesInUse;
+    };
+
+    /**
+     * Represents an allocator that serves small allocations from per-size-class pools
+     * with a per-thread cache in front of each pool, so that most allocations and frees
+     * do not synchronize with other threads.
+     *
+     * Requests up to MaxPooledSize bytes are rounded up to one of ClassCount size classes.
+     * Larger requests go to std::malloc. Pooled memory is returned to the system only
+     * when the allocator is destroyed.
+     *
+     * The allocator must outlive every allocation made from it. When installed with
+     * InstallAllocator, call UninstallAllocator before destroying it.
+     */
+    class PoolAllocator : public Allocator {
+
+    public:
+
+        /**
+         * Largest request served from the pools.
+         */
+        static constexpr std::size_t MaxPooledSize = 4096;
+
+        /**
+         * Number of size classes: 16-byte steps up to 256 bytes,
+         * then four classes per power of two up to MaxPooledSize.
+         */
+        static constexpr std::size_t ClassCount = 32;
+
+    private:
+        static constexpr std::uint32_t LargeClass = std::numeric_limits<std::uint32_t>::max();
+        static constexpr std::size_t ChunkSize = (64 * 1024);
+        static constexpr std::size_t CounterShards = 16;
+
+        struct Header {
+            std::uint32_t Class;
+            std::uint32_t Size;
+        };
+
+        struct Block {
+            Block* pNext;
+        };
+
+        struct FreeList {
+            Block* pHead = nullptr;
+            std::size_t Count = 0;
+        };
+
+        struct alignas(64) CentralList {
+            std::mutex Mutex;
+            FreeList List;
+        };
+
+        struct alignas(64) Counters {
+            std::atomic<std::uint64_t> Allocations = 0;
+            std::atomic<std::uint64_t> Frees = 0;
+            std::atomic<std::uint64_t> Reallocations = 0;
+            std::atomic<std::uint64_t> LargeAllocations = 0;
+            std::atomic<std::uint64_t> CentralTransfers = 0;
+            std::atomic<std::int64_t> BytesInUse = 0;
+        };
+
+        struct ThreadCache {
+            std::uint64_t OwnerId;
+            PoolAllocator* pOwner;
+            std::array<FreeList, ClassCount> Lists;
+        };
+
+        struct ThreadCaches {
+            std::vector<std::unique_ptr<ThreadCache>> Caches;
+            ThreadCache* pLast = nullptr;
+            ~ThreadCaches(void);
+        };
+
+        struct Registry {
+            std::mutex Mutex;
+            std::unordered_set<std::uint64_t> Live;
+            std::uint64_t NextId = 1;
+        };
+
+        std::uint64_t m_id;
+        std::size_t m_batchSize;
+        std::array<CentralList, ClassCount> m_central;
+        std::array<Counters, CounterShards> m_counters;
+        std::mutex m_chunkMutex;
+        std::vector<void*> m_chunks;
+
+        static Registry& GetRegistry(void);
+        static ThreadCaches* GetThreadCaches(void);
+        static bool& GetThreadExited(void);
+
+        static constexpr std::size_t GetClass(const std::size_t size);
+        static constexpr std::size_t GetClassSize(const std::size_t sizeClass);
+
+        ThreadCache* GetThreadCache(void);
+        Counters& GetCounters(void);
+
+        bool Refill(FreeList& list, const std::size_t sizeClass);
+        void Flush(FreeList& list, const std::size_t sizeClass, std::size_t count) noexcept;
+
+        void* AllocateLarge(const std::size_t size);
+
+    public:
+
+        /**
+         * Constructs a new PoolAllocator object.
+         *
+         * @param batchSize Number of blocks moved between a thread cache and a pool at a time.
+         * A thread cache holds at most 2 * batchSize free blocks per size class.
+         * @exception std::invalid_argument - The 'batchSize' parameter is zero.
+         */
+        explicit PoolAllocator(const std::size_t batchSize = 32);
+
+        PoolAllocator(const PoolAllocator&) = delete;
+        PoolAllocator(PoolAllocator&&) = delete;
+
+        /**
+         * Frees all pooled memory.
+         */
+        virtual ~PoolAllocator(void);
+
+        PoolAllocator& operator= (const PoolAllocator&) = delete;
+        PoolAllocator& operator= (PoolAllocator&&) = delete;
+
+        void* Allocate(const std::size_t size) override;
+        void Free(void* const pMemory) noexcept override;
+        void* Reallocate(void* const pMemory, const std::size_t size) override;
+        std::size_t GetSize(void* const pMemory) const noexcept override;
+        std::size_t RoundUp(const std::size_t size) const noexcept override;
+
+        /**
+         * Returns the allocator counters.
+         *
+         * @returns An AllocatorStatistics.
+         */
+        AllocatorStatistics GetStatistics(void) const;
+
+    };
+
+    /**
+     * Represents a buffer that SQLite uses for page cache memory (SQLITE_CONFIG_PAGECACHE).
+     * Pages that do not fit in the buffer are allocated from the general-purpose allocator.
+     *
+     * The buffer must outlive its use by SQLite. When installed with InstallPageCache,
+     * call UninstallPageCache before destroying it.
+     */
+    class PageCacheBuffer {
+
+    private:
+        std::unique_ptr<std::byte[]> m_pBuffer;
+        std::int32_t m_slotSize;
+        std::int32_t m_slotCount;
+
+    public:
+
+        /**
+         * Constructs a new PageCacheBuffer object.
+         *
+         * @param pageSize Database page size in bytes.
+         * @param pages Number of pages.
+         * @exception std::invalid_argument - The 'pageSize' or 'pages' parameter is not positive.
+         * @exception SqliteException - SQLite is already initialized.
+         */
+        PageCacheBuffer(const std::int32_t pageSize, const std::int32_t pages);
+
+        PageCacheBuffer(const PageCacheBuffer&) = delete;
+        PageCacheBuffer(PageCacheBuffer&&) = delete;
+        virtual ~PageCacheBuffer(void) = default;
+
+        PageCacheBuffer& operator= (const PageCacheBuffer&) = delete;
+        PageCacheBuffer& operator= (PageCacheBuffer&&) = delete;
+
+        void* GetBuffer(void) const;
+
+        /**
+         * Returns the size of a slot: the page size plus SQLite's per-page header.
+         *
+         * @returns Number of bytes.
+         */
+        std::int32_t GetSlotSize(void) const;
+
+        std::int32_t GetSlotCount(void) const;
+
+    };
+
+    /**
+     * Makes SQLite use an allocator for all of its memory (SQLITE_CONFIG_MALLOC).
+     * Must be called before SQLite is initialized, i.e. before the first Database is opened,
+     * or after UninstallAllocator.
+     *
+     * @param allocator The allocator. Must outlive its installation.
+     * @param memoryStatus Keep SQLite's global memory accounting (SQLITE_CONFIG_MEMSTATUS).
+     * It serializes every allocation on a global mutex, but is required by sqlite3_memory_used
+     * and by Database::SetSoftHeapLimit.
+     * @exception SqliteException - SQLite is already initialized.
+     */
+    void InstallAllocator(Allocator& allocator, const bool memoryStatus = true);
+
+    /**
+     * Shuts SQLite down and restores the allocator that was in use before InstallAllocator,
+     * with memory accounting enabled. All databases must be closed.
+     *
+     * @exception SqliteException
+     */
+    void UninstallAllocator(void);
+
+    /**
+     * Makes SQLite use a buffer for page cache memory (SQLITE_CONFIG_PAGECACHE).
+     * Must be called before SQLite is initialized.
+     *
+     * @param buffer The buffer. Must outlive its installation.
+     * @exception SqliteException - SQLite is already initialized.
+     */
+    void InstallPageCache(PageCacheBuffer& buffer);
+
+    /**
+     * Shuts SQLite down and stops using the page cache buffer. All databases must be closed.
+     *
+     * @exception SqliteException
+     */
+    void UninstallPageCache(void);
+
+    /**
+     * Adapts the installed Allocator to sqlite3_mem_methods.
+     * SQLite does not pass user data to its allocation routines, so the allocator is global.
+     */
+    struct AllocatorHooks {
+
+        static Allocator*& GetAllocator(void);
+        static sqlite3_mem_methods& GetPrevious(void);
+
+        static void* Malloc(int size);
+        static void Free(void* pMemory);
+        static void* Realloc(void* pMemory, int size);
+        static int Size(void* pMemory);
+        static int Roundup(int size);
+        static int Init(void* pAppData);
+        static void Shutdown(void* pAppData);
+
+    };
+
+    inline std::size_t Allocator::RoundUp(const std::size_t size) const noexcept {
+        return ((size + 7) & ~static_cast<std::size_t>(7));
+    }
+
+    inline PoolAllocator::PoolAllocator(const std::size_t batchSize) : m_batchSize(batchSize) {
+
+        if (batchSize == 0)
+            throw std::invalid_argument("'batchSize': Must be greater than zero.");
+
+        Registry& registry = GetRegistry();
+        const std::lock_guard<std::mutex> lock(registry.Mutex);
+        this->m_id = registry.NextId++;
+        registry.Live.insert(this->m_id);
+
+    }
+
+    inline PoolAllocator::~PoolAllocator() {
+
+        {
+            Registry& registry = GetRegistry();
+            const std::lock_guard<std::mutex> lock(registry.Mutex);
+            registry.Live.erase(this->m_id);
+        }
+
+        for (void* pChunk : this->m_chunks) std::free(pChunk);
+
+    }
+
+    inline PoolAllocator::ThreadCaches::~ThreadCaches() {
+
+        // Return cached blocks to allocators that are still alive.
+        Registry& registry = GetRegistry();
+        const std::lock_guard<std::mutex> lock(registry.Mutex);
+
+        for (const std::unique_ptr<ThreadCache>& pCache : this->Caches) {
+            if (!registry.Live.contains(pCache->OwnerId)) continue;
+            for (std::size_t i = 0; i < ClassCount; ++i)
+                pCache->pOwner->Flush(pCache->Lists[i], i, pCache->Lists[i].Count);
+        }
+
+        GetThreadExited() = true;
+
+    }
+
+    inline PoolAllocator::Registry& PoolAllocator::GetRegistry() {
+        static Registry registry = { };
+        return registry;
+    }
+
+    inline PoolAllocator::ThreadCaches* PoolAllocator::GetThreadCaches() {
+        if (GetThreadExited()) return nullptr;
+        thread_local ThreadCaches caches = { };
+        return &caches;
+    }
+
+    inline bool& PoolAllocator::GetThreadExited() {
+        // Trivially destructible, so it stays usable while other thread-local objects are destroyed.
+        thread_local bool exited = false;
+        return exited;
+    }
+
+    inline constexpr std::size_t PoolAllocator::GetClass(const std::size_t size) {
+
+        if (size <= 256) return ((size == 0) ? 0 : (((size + 15) / 16) - 1));
+
+        const std::size_t log = std::bit_width(size - 1);
+        return (16 + ((log - 9) * 4) + (((size - 1) - (std::size_t(1) << (log - 1))) >> (log - 3)));
+    }
+
+    inline constexpr std::size_t PoolAllocator::GetClassSize(const std::size_t sizeClass) {
+
+        if (sizeClass < 16) return ((sizeClass + 1) * 16);
+
+        const std::size_t log = (9 + ((sizeClass - 16) / 4));
+        return ((std::size_t(1) << (log - 1)) + ((((sizeClass - 16) % 4) + 1) << (log - 3)));
+    }
+
+    inline PoolAllocator::ThreadCache* PoolAllocator::GetThreadCache() {
+
+        ThreadCaches* pCaches = GetThreadCaches();
+        if (!pCaches) return nullptr;
+
+        if (pCaches->pLast && (pCaches->pLast->OwnerId == this->m_id)) return pCaches->pLast;
+
+        for (const std::unique_ptr<ThreadCache>& pCache : pCaches->Caches) {
+            if (pCache->OwnerId == this->m_id) {
+                pCaches->pLast = pCache.get();
+                return pCache.get();
+            }
+        }
+
+        std::unique_ptr<ThreadCache>& pCache = pCaches->Caches.emplace_back(std::make_unique<ThreadCache>());
+        pCache->OwnerId = this->m_id;
+        pCache->pOwner = this;
+        pCaches->pLast = pCache.get();
+
+        return pCache.get();
+    }
+
+    inline PoolAllocator::Counters& PoolAllocator::GetCounters() {
+        thread_local const std::size_t shard = (std::hash<std::thread::id> { }(std::this_thread::get_id()) % CounterShards);
+        return this->m_counters[shard];
+    }
+
+    inline bool PoolAllocator::Refill(FreeList& list, const std::size_t sizeClass) {
+
+        CentralList& central = this->m_central[sizeClass];
+
+        {
+            const std::lock_guard<std::mutex> lock(central.Mutex);
+
+            while ((list.Count < this->m_batchSize) && central.List.pHead) {
+                Block* pBlock = central.List.pHead;
+                central.List.pHead = pBlock->pNext;
+                --central.List.Count;
+                pBlock->pNext = list.pHead;
+                list.pHead = pBlock;
+                ++list.Count;
+            }
+        }
+
+        if (list.pHead) {
+            this->GetCounters().CentralTransfers.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        const std::size_t blockSize = (sizeof(Header) + GetClassSize(sizeClass));
+        const std::size_t blocks = std::max((ChunkSize / blockSize), this->m_batchSize);
+
+        std::byte* pChunk = static_cast<std::byte*>(std::malloc(blocks * blockSize));
+        if (!pChunk) return false;
+
+        try {
+            const std::lock_guard<std::mutex> lock(this->m_chunkMutex);
+            this->m_chunks.push_back(pChunk);
+        }
+        catch (...) {
+            std::free(pChunk);
+            return false;
+        }
+
+        for (std::size_t i = 0; i < blocks; ++i) {
+            Block* pBlock = reinterpret_cast<Block*>(pChunk + (i * blockSize));
+            pBlock->pNext = list.pHead;
+            list.pHead = pBlock;
+            ++list.Count;
+        }
+
+        return true;
+    }
+
+    inline void PoolAllocator::Flush(FreeList& list, const std::size_t sizeClass, std::size_t count) noexcept {
+
+        if (count == 0) return;
+
+        CentralList& central = this->m_central[sizeClass];
+        const std::lock_guard<std::mutex> lock(central.Mutex);
+
+        while ((count-- > 0) && list.pHead) {
+            Block* pBlock = list.pHead;
+            list.pHead = pBlock->pNext;
+            --list.Count;
+            pBlock->pNext = central.List.pHead;
+            central.List.pHead = pBlock;
+            ++central.List.Count;
+        }
+
+    }
+
+    inline void* PoolAllocator::AllocateLarge(const std::size_t size) {
+
+        const std::size_t rounded = Allocator::RoundUp(size);
+        if (rounded > std::numeric_limits<std::uint32_t>::max()) return nullptr;
+
+        Header* pHeader = static_cast<Header*>(std::malloc(sizeof(Header) + rounded));
+        if (!pHeader) return nullptr;
+
+        pHeader->Class = LargeClass;
+        pHeader->Size = static_cast<std::uint32_t>(rounded);
+
+        Counters& counters = this->GetCounters();
+        counters.Allocations.fetch_add(1, std::memory_order_relaxed);
+        counters.LargeAllocations.fetch_add(1, std::memory_order_relaxed);
+        counters.BytesInUse.fetch_add(static_cast<std::int64_t>(rounded), std::memory_order_relaxed);
+
+        return (pHeader + 1);
+    }
+
+    inline void* PoolAllocator::Allocate(const std::size_t size) {
+
+        static_assert(ClassCount == (GetClass(MaxPooledSize) + 1));
+        static_assert(GetClassSize(ClassCount - 1) == MaxPooledSize);
+
+        if (size > MaxPooledSize) return this->AllocateLarge(size);
+
+        // Threads that have already destroyed their cache fall back to std::malloc.
+        ThreadCache* pCache = this->GetThreadCache();
+        if (!pCache) return this->AllocateLarge(size);
+
+        const std::size_t sizeClass = GetClass(size);
+        FreeList& list = pCache->Lists[sizeClass];
+        if (!list.pHead && !this->Refill(list, sizeClass)) return nullptr;
+
+        Block* pBlock = list.pHead;
+        list.pHead = pBlock->pNext;
+        --list.Count;
+
+        Header* pHeader = reinterpret_cast<Header*>(pBlock);
+        pHeader->Class = static_cast<std::uint32_t>(sizeClass);
+        pHeader->Size = static_cast<std::uint32_t>(GetClassSize(sizeClass));
+
+        Counters& counters = this->GetCounters();
+        counters.Allocations.fetch_add(1, std::memory_order_relaxed);
+        counters.BytesInUse.fetch_add(pHeader->Size, std::memory_order_relaxed);
+
+        return (pHeader + 1);
+    }
+
+    inline void PoolAllocator::Free(void* const pMemory) noexcept {
+
+        if (!pMemory) return;
+
+        Header* pHeader = (static_cast<Header*>(pMemory) - 1);
+
+        Counters& counters = this->GetCounters();
+        counters.Frees.fetch_add(1, std::memory_order_relaxed);
+        counters.BytesInUse.fetch_sub(pHeader->Size, std::memory_order_relaxed);
+
+        if (pHeader->Class == LargeClass) {
+            std::free(pHeader);
+            return;
+        }
+
+        const std::size_t sizeClass = pHeader->Class;
+        Block* pBlock = reinterpret_cast<Block*>(pHeader);
+
+        ThreadCache* pCache = this->GetThreadCache();
+        if (!pCache) {
+            FreeList list = { pBlock, 1 };
+            pBlock->pNext = nullptr;
+            this->Flush(list, sizeClass, 1);
+            return;
+        }
+
+        FreeList& list = pCache->Lists[sizeClass];
+        pBlock->pNext = list.pHead;
+        list.pHead = pBlock;
+        ++list.Count;
+
+        if (list.Count > (2 * this->m_batchSize))
+            this->Flush(list, sizeClass, this->m_batchSize);
+
+    }
+
+    inline void* PoolAllocator::Reallocate(void* const pMemory, const std::size_t size) {
+
+        if (!pMemory) return this->Allocate(size);
+
+        const std::size_t current = this->GetSize(pMemory);
+        const Header* pHeader = (static_cast<const Header*>(pMemory) - 1);
+
+        // Stay in place if the block already has the size class the new size maps to.
+        if ((pHeader->Class != LargeClass) && (size <= MaxPooledSize) && (GetClass(size) == pHeader->Class))
+            return pMemory;
+
+        void* pNew = this->Allocate(size);
+        if (!pNew) return nullptr;
+
+        std::memcpy(pNew, pMemory, std::min(current, size));
+        this->Free(pMemory);
+        this->GetCounters().Reallocations.fetch_add(1, std::memory_order_relaxed);
+
+        return pNew;
+    }
+
+    inline std::size_t PoolAllocator::GetSize(void* const pMemory) const noexcept {
+        if (!pMemory) return 0;
+        return (static_cast<const Header*>(pMemory) - 1)->Size;
+    }
+
+    inline std::size_t PoolAllocator::RoundUp(const std::size_t size) const noexcept {
+        if (size > MaxPooledSize) return Allocator::RoundUp(size);
+        return GetClassSize(GetClass(size));
+    }
+
+    inline AllocatorStatistics PoolAllocator::GetStatistics() const {
+
+        AllocatorStatistics stats = { };
+
+        for (const Counters& counters : this->m_counters) {
+            stats.Allocations += counters.Allocations.load(std::memory_order_relaxed);
+            stats.Frees += counters.Frees.load(std::memory_order_relaxed);
+            stats.Reallocations += counters.Reallocations.load(std::memory_order_relaxed);
+            stats.LargeAllocations += counters.LargeAllocations.load(std::memory_order_relaxed);
+            stats.CentralTransfers += counters.CentralTransfers.load(std::memory_order_relaxed);
+            stats.BytesInUse += counters.BytesInUse.load(std::memory_order_relaxed);
+        }
+
+        {
+            const std::lock_guard<std::mutex> lock(const_cast<std::mutex&>(this->m_chunkMutex));
+            stats.Chunks = this->m_chunks.size();
+        }
+
+        return stats;
+    }
+
+    inline PageCacheBuffer::PageCacheBuffer(const std::int32_t pageSize, const std::int32_t pages) {
+
+        if (pageSize <= 0)
+            throw std::invalid_argument("'pageSize': Must be greater than zero.");
+
+        if (pages <= 0)
+            throw std::invalid_argument("'pages': Must be greater than zero.");
+
+        int headerSize = 0;
+        const std::int32_t res = sqlite3_config(SQLITE_CONFIG_PCACHE_HDRSZ, &headerSize);
+        if (res != SQLITE_OK) throw SqliteException("PageCacheBuffer::PageCacheBuffer(): SQLite is already initialized.", res, res);
+
+        this->m_slotSize = ((pageSize + headerSize + 7) & ~7);
+        this->m_slotCount = pages;
+        this->m_pBuffer = std::make_unique<std::byte[]>(static_cast<std::size_t>(this->m_slotSize) * pages);
+
+    }
+
+    inline void* PageCacheBuffer::GetBuffer() const {
+        return this->m_pBuffer.get();
+    }
+
+    inline std::int32_t PageCacheBuffer::GetSlotSize() const {
+        return this->m_slotSize;
+    }
+
+    inline std::int32_t PageCacheBuffer::GetSlotCount() const {
+        return this->m_slotCount;
+    }
+
+    inline Allocator*& AllocatorHooks::GetAllocator() {
+        static Allocator* pAllocator = nullptr;
+        return pAllocator;
+    }
+
+    inline sqlite3_mem_methods& AllocatorHooks::GetPrevious() {
+        static sqlite3_mem_methods previous = { };
+        return previous;
+    }
+
+    inline void* AllocatorHooks::Malloc(int size) {
+        return GetAllocator()->Allocate(static_cast<std::size_t>(size));
+    }
+
+    inline void AllocatorHooks::Free(void* pMemory) {
+        GetAllocator()->Free(pMemory);
+    }
+
+    inline void* AllocatorHooks::Realloc(void* pMemory, int size) {
+        return GetAllocator()->Reallocate(pMemory, static_cast<std::size_t>(size));
+    }
+
+    inline int AllocatorHooks::Size(void* pMemory) {
+        return static_cast<int>(GetAllocator()->GetSize(pMemory));
+    }
+
+    inline int AllocatorHooks::Roundup(int size) {
+        return static_cast<int>(GetAllocator()->RoundUp(static_cast<std::size_t>(size)));
+    }
+
+    inline int AllocatorHooks::Init(void*) {
+        return SQLITE_OK;
+    }
+
+    inline void AllocatorHooks::Shutdown(void*) { }
+
+    inline void InstallAllocator(Allocator& allocator, const bool memoryStatus) {
+
+        std::int32_t res = SQLITE_OK;
+
+        if (!AllocatorHooks::GetAllocator()) {
+            res = sqlite3_config(SQLITE_CONFIG_GETMALLOC, &AllocatorHooks::GetPrevious());
+            if (res != SQLITE_OK) throw SqliteException("InstallAllocator(): SQLite is already initialized.", res, res);
+        }
+
+        static const sqlite3_mem_methods methods = {
+            &AllocatorHooks::Malloc,
+            &AllocatorHooks::Free,
+            &AllocatorHooks::Realloc,
+            &AllocatorHooks::Size,
+            &AllocatorHooks::Roundup,
+            &AllocatorHooks::Init,
+            &AllocatorHooks::Shutdown,
+            nullptr,
+        };
+
+        res = sqlite3_config(SQLITE_CONFIG_MALLOC, &methods);
+        if (res != SQLITE_OK) throw SqliteException("InstallAllocator(): SQLite is already initialized.", res, res);
+
+        AllocatorHooks::GetAllocator() = &allocator;
+        sqlite3_config(SQLITE_CONFIG_MEMSTATUS, (memoryStatus ? 1 : 0));
+
+    }
+
+    inline void UninstallAllocator() {
+
+        if (!AllocatorHooks::GetAllocator()) return;
+
+        std::int32_t res = sqlite3_shutdown();
+        if (res != SQLITE_OK) throw SqliteException("UninstallAllocator(): Cannot shut SQLite down.", res, res);
+
+        res = sqlite3_config(SQLITE_CONFIG_MALLOC, &AllocatorHooks::GetPrevious());
+        if (res != SQLITE_OK) throw SqliteException("UninstallAllocator(): Cannot restore the previous allocator.", res, res);
+
+        sqlite3_config(SQLITE_CONFIG_MEMSTATUS, 1);
+        AllocatorHooks::GetAllocator() = nullptr;
+
+    }
+
+    inline void InstallPageCache(PageCacheBuffer& buffer) {
+        const std::int32_t res = sqlite3_config(SQLITE_CONFIG_PAGECACHE, buffer.GetBuffer(), buffer.GetSlotSize(), buffer.GetSlotCount());
+        if (res != SQLITE_OK) throw SqliteException("InstallPageCache(): SQLite is already initialized.", res, res);
+    }
+
+    inline void UninstallPageCache() {
+
+        std::int32_t res = sqlite3_shutdown();
+        if (res != SQLITE_OK) throw SqliteException("UninstallPageCache(): Cannot shut SQLite down.", res, res);
+
+        res = sqlite3_config(SQLITE_CONFIG_PAGECACHE, nullptr, 0, 0);
+        if (res != SQLITE_OK) throw SqliteException("UninstallPageCache(): Cannot remove the page cache buffer.", res, res);
+
+    }
+
+}
+
+#endif // _VSQLITE_ALLOCATOR_H_
\ No newline at end of file
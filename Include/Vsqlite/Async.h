@@ -0,0 +1,279 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#ifndef _VSQLITE_ASYNC_H_
+#define _VSQLITE_ASYNC_H_
+
+#include <Vsqlite/SQLite.h>
+#include <Vsqlite/Database.h>
+#include <Vsqlite/Statement.h>
+#include <Vsqlite/StatementCache.h>
+#include <Vsqlite/RowRange.h>
+
+#include <coroutine>
+#include <functional>
+#include <optional>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <deque>
+#include <span>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <cstddef>
+
+namespace Vsqlite {
+
+    /**
+     * Represents an object that runs work items.
+     */
+    class Executor {
+
+    public:
+        virtual ~Executor(void) = default;
+
+        /**
+         * Schedules a work item for execution.
+         *
+         * @param work A work item.
+         */
+        virtual void Post(std::function<void()> work) = 0;
+
+    };
+
+    /**
+     * Represents an executor that runs work items on a fixed set of threads.
+     */
+    class ThreadPoolExecutor : public Executor {
+
+    private:
+        std::vector<std::thread> m_threads;
+        std::deque<std::function<void()>> m_queue;
+        std::mutex m_mutex;
+        std::condition_variable m_available;
+        bool m_stopping;
+
+        void Run(void);
+
+    public:
+
+        /**
+         * Constructs a new ThreadPoolExecutor object.
+         *
+         * @param threads Number of worker threads.
+         * @exception std::invalid_argument - The 'threads' parameter is zero.
+         */
+        explicit ThreadPoolExecutor(const std::size_t threads);
+
+        ThreadPoolExecutor(const ThreadPoolExecutor&) = delete;
+        ThreadPoolExecutor(ThreadPoolExecutor&&) = delete;
+
+        /**
+         * Runs the queued work items and stops the worker threads.
+         */
+        virtual ~ThreadPoolExecutor(void);
+
+        ThreadPoolExecutor& operator= (const ThreadPoolExecutor&) = delete;
+        ThreadPoolExecutor& operator= (ThreadPoolExecutor&&) = delete;
+
+        void Post(std::function<void()> work) override;
+
+        /**
+         * Returns the process-wide executor used by asynchronous operations
+         * that are not given a worker executor.
+         *
+         * @returns A ThreadPoolExecutor.
+         */
+        static ThreadPoolExecutor& GetDefault(void);
+
+    };
+
+    /**
+     * Represents an awaitable operation that runs on a worker executor.
+     *
+     * The awaiting coroutine is always resumed on the resume executor given at construction,
+     * typically the executor of the caller's event loop, never on the worker thread.
+     *
+     * @tparam T Result type.
+     */
+    template <typename T>
+    class AsyncOperation {
+
+        static_assert(!std::is_void_v<T>, "AsyncOperation: T must not be void.");
+
+    private:
+        std::function<T()> m_work;
+        Executor* m_pWorker;
+        Executor* m_pResume;
+        std::optional<T> m_result;
+        std::exception_ptr m_error;
+
+    public:
+
+        /**
+         * Constructs a new AsyncOperation object.
+         *
+         * @param work The operation.
+         * @param resume The executor that resumes the awaiting coroutine.
+         */
+        AsyncOperation(std::function<T()> work, Executor& resume);
+
+        AsyncOperation(const AsyncOperation&) = delete;
+        AsyncOperation(AsyncOperation&&) = default;
+        virtual ~AsyncOperation(void) = default;
+
+        AsyncOperation& operator= (const AsyncOperation&) = delete;
+        AsyncOperation& operator= (AsyncOperation&&) = default;
+
+        /**
+         * Sets the executor that runs the operation.
+         *
+         * @param executor An executor.
+         * @returns The operation.
+         */
+        AsyncOperation&& On(Executor& executor) &&;
+
+        bool await_ready(void) const noexcept;
+        void await_suspend(std::coroutine_handle<> handle);
+        T await_resume(void);
+
+    };
+
+    inline ThreadPoolExecutor::ThreadPoolExecutor(const std::size_t threads) {
+
+        if (threads == 0)
+            throw std::invalid_argument("'threads': Must be greater than zero.");
+
+        this->m_stopping = false;
+        this->m_threads.reserve(threads);
+
+        for (std::size_t i = 0; i < threads; ++i)
+            this->m_threads.emplace_back(&ThreadPoolExecutor::Run, this);
+
+    }
+
+    inline ThreadPoolExecutor::~ThreadPoolExecutor() {
+
+        {
+            const std::lock_guard<std::mutex> lock(this->m_mutex);
+            this->m_stopping = true;
+        }
+
+        this->m_available.notify_all();
+        for (std::thread& thread : this->m_threads) thread.join();
+
+    }
+
+    inline void ThreadPoolExecutor::Run() {
+
+        while (true) {
+
+            std::function<void()> work = nullptr;
+
+            {
+                std::unique_lock<std::mutex> lock(this->m_mutex);
+                this->m_available.wait(lock, [this] () { return (this->m_stopping || !this->m_queue.empty()); });
+                if (this->m_queue.empty()) return;
+
+                work = std::move(this->m_queue.front());
+                this->m_queue.pop_front();
+            }
+
+            work();
+
+        }
+
+    }
+
+    inline void ThreadPoolExecutor::Post(std::function<void()> work) {
+
+        {
+            const std::lock_guard<std::mutex> lock(this->m_mutex);
+            this->m_queue.push_back(std::move(work));
+        }
+
+        this->m_available.notify_one();
+
+    }
+
+    inline ThreadPoolExecutor& ThreadPoolExecutor::GetDefault() {
+        static ThreadPoolExecutor executor(std::max<std::size_t>(std::thread::hardware_concurrency(), 2));
+        return executor;
+    }
+
+    template <typename T>
+    inline AsyncOperation<T>::AsyncOperation(std::function<T()> work, Executor& resume)
+        : m_work(std::move(work)), m_pWorker(&ThreadPoolExecutor::GetDefault()), m_pResume(&resume), m_result(), m_error(nullptr) { }
+
+    template <typename T>
+    inline AsyncOperation<T>&& AsyncOperation<T>::On(Executor& executor) && {
+        this->m_pWorker = &executor;
+        return std::move(*this);
+    }
+
+    template <typename T>
+    inline bool AsyncOperation<T>::await_ready() const noexcept {
+        return false;
+    }
+
+    template <typename T>
+    inline void AsyncOperation<T>::await_suspend(std::coroutine_handle<> handle) {
+        this->m_pWorker->Post([this, handle] () {
+
+            try {
+                this->m_result.emplace(this->m_work());
+            }
+            catch (...) {
+                this->m_error = std::current_exception();
+            }
+
+            this->m_pResume->Post([handle] () { handle.resume(); });
+
+        });
+    }
+
+    template <typename T>
+    inline T AsyncOperation<T>::await_resume() {
+        if (this->m_error) std::rethrow_exception(this->m_error);
+        return std::move(this->m_result.value());
+    }
+
+    inline AsyncOperation<bool> Statement::StepAsync(Executor& resume) {
+        return AsyncOperation<bool>([this] () {
+            this->Step();
+            return this->m_canFetch;
+        }, resume);
+    }
+
+    template <typename... Ts, typename... Args>
+    inline AsyncOperation<std::vector<typename RowValue<Ts...>::Type>> Database::QueryAsync(Executor& resume, const std::string_view sql, Args&&... args) {
+
+        static_assert(((!std::is_same_v<Ts, std::string_view>) && ...), "Database::QueryAsync(): std::string_view does not outlive the row.");
+        static_assert(((!std::is_same_v<Ts, std::span<const std::byte>>) && ...), "Database::QueryAsync(): std::span does not outlive the row.");
+
+        using Row = typename RowValue<Ts...>::Type;
+
+        return AsyncOperation<std::vector<Row>>([this, sql = std::string(sql), ...args = std::forward<Args>(args)] () {
+
+            CachedStatement statement = this->Cached(sql);
+            if constexpr (sizeof...(Args) != 0) statement->Bind(args...);
+
+            std::vector<Row> rows = { };
+            for (const Row& row : statement->template Rows<Ts...>()) rows.push_back(row);
+
+            return rows;
+        }, resume);
+    }
+
+}
+
+#endif // _VSQLITE_ASYNC_H_
\ No newline at end of file
@@ -0,0 +1,350 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#ifndef _VSQLITE_ASYNCWRITER_H_
+#define _VSQLITE_ASYNCWRITER_H_
+
+#include <Vsqlite/SQLite.h>
+#include <Vsqlite/Database.h>
+#include <Vsqlite/Statement.h>
+#include <Vsqlite/StatementCache.h>
+#include <Vsqlite/Transaction.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <future>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <chrono>
+#include <exception>
+#include <stdexcept>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+namespace Vsqlite {
+
+    /**
+     * AsyncWriter settings.
+     */
+    struct AsyncWriterOptions {
+
+        /**
+         * Maximum number of jobs committed in a single transaction.
+         */
+        std::size_t MaxBatchSize = 256;
+
+        /**
+         * Maximum time the first job of a batch waits for more jobs before the batch is committed.
+         */
+        std::chrono::microseconds MaxLatency = std::chrono::milliseconds(2);
+
+    };
+
+    /**
+     * AsyncWriter counters.
+     */
+    struct AsyncWriterStatistics {
+        std::uint64_t Jobs;
+        std::uint64_t Batches;
+    };
+
+    /**
+     * Runs write jobs submitted from any thread on a dedicated connection and thread,
+     * committing the jobs queued within a flush window in a single transaction.
+     *
+     * Every job runs inside its own savepoint, so a failing job is rolled back
+     * without affecting the rest of its batch. A job's future becomes ready once its
+     * batch has been committed. Jobs must not begin, commit or roll back transactions.
+     */
+    class AsyncWriter {
+
+    private:
+        struct Job {
+            std::atomic<Job*> Next;
+            std::function<void(Database&)> Work;
+            std::promise<void> Promise;
+            std::exception_ptr Error;
+        };
+
+        Database m_database;
+        AsyncWriterOptions m_options;
+
+        std::atomic<Job*> m_head;
+        Job* m_tail;
+        Job m_stub;
+
+        std::atomic<bool> m_stopping;
+        std::atomic<bool> m_sleeping;
+        std::mutex m_mutex;
+        std::condition_variable m_wakeup;
+
+        std::atomic<std::uint64_t> m_jobs;
+        std::atomic<std::uint64_t> m_batches;
+
+        std::thread m_thread;
+
+        void Push(Job* const pJob) noexcept;
+        Job* Pop(void) noexcept;
+        bool IsEmpty(void) const noexcept;
+        bool Wait(const std::chrono::steady_clock::time_point deadline);
+
+        void Run(void);
+        void Commit(std::vector<std::unique_ptr<Job>>& batch);
+
+    public:
+
+        /**
+         * Constructs a new AsyncWriter object and starts its writer thread.
+         *
+         * @param database The write connection. The AsyncWriter takes ownership of it.
+         * @param options Batching settings.
+         * @exception std::invalid_argument - options.MaxBatchSize is zero.
+         */
+        AsyncWriter(Database&& database, const AsyncWriterOptions& options = { });
+
+        AsyncWriter(const AsyncWriter&) = delete;
+        AsyncWriter(AsyncWriter&&) = delete;
+
+        /**
+         * Commits all queued jobs and stops the writer thread.
+         */
+        virtual ~AsyncWriter(void);
+
+        AsyncWriter& operator= (const AsyncWriter&) = delete;
+        AsyncWriter& operator= (AsyncWriter&&) = delete;
+
+        /**
+         * Queues a write job.
+         *
+         * @param work A function that performs writes on the write connection.
+         * @returns A future that becomes ready once the job has been committed,
+         * or holds the exception thrown by the job or by the commit.
+         */
+        std::future<void> Submit(std::function<void(Database&)> work);
+
+        /**
+         * Queues a statement for execution. The statement is prepared through the
+         * write connection's statement cache.
+         *
+         * @tparam Args...
+         * @param sql An SQL statement.
+         * @param args Parameter values. The values are copied; pointed-to and borrowed data must outlive the job.
+         * @returns A future that becomes ready once the statement has been committed,
+         * or holds the exception thrown by the statement or by the commit.
+         */
+        template <typename... Args>
+        std::future<void> Execute(const std::string_view sql, Args&&... args);
+
+        /**
+         * Returns the writer counters.
+         *
+         * @returns An AsyncWriterStatistics.
+         */
+        AsyncWriterStatistics GetStatistics(void) const;
+
+    };
+
+    inline AsyncWriter::AsyncWriter(Database&& database, const AsyncWriterOptions& options)
+        : m_database(std::move(database)), m_options(options) {
+
+        if (options.MaxBatchSize == 0)
+            throw std::invalid_argument("'options': MaxBatchSize must be greater than zero.");
+
+        this->m_stub.Next.store(nullptr);
+        this->m_head.store(&this->m_stub);
+        this->m_tail = &this->m_stub;
+
+        this->m_stopping.store(false);
+        this->m_sleeping.store(false);
+        this->m_jobs.store(0);
+        this->m_batches.store(0);
+
+        this->m_thread = std::thread(&AsyncWriter::Run, this);
+
+    }
+
+    inline AsyncWriter::~AsyncWriter() {
+
+        {
+            const std::lock_guard<std::mutex> lock(this->m_mutex);
+            this->m_stopping.store(true);
+        }
+
+        this->m_wakeup.notify_one();
+        this->m_thread.join();
+
+    }
+
+    inline void AsyncWriter::Push(Job* const pJob) noexcept {
+        pJob->Next.store(nullptr, std::memory_order_relaxed);
+        Job* const pPrev = this->m_head.exchange(pJob);
+        pPrev->Next.store(pJob, std::memory_order_release);
+    }
+
+    inline AsyncWriter::Job* AsyncWriter::Pop() noexcept {
+
+        Job* pTail = this->m_tail;
+        Job* pNext = pTail->Next.load(std::memory_order_acquire);
+
+        if (pTail == &this->m_stub) {
+            if (!pNext) return nullptr;
+            this->m_tail = pNext;
+            pTail = pNext;
+            pNext = pNext->Next.load(std::memory_order_acquire);
+        }
+
+        if (pNext) {
+            this->m_tail = pNext;
+            return pTail;
+        }
+
+        if (pTail != this->m_head.load()) return nullptr;
+
+        this->Push(&this->m_stub);
+
+        pNext = pTail->Next.load(std::memory_order_acquire);
+        if (pNext) {
+            this->m_tail = pNext;
+            return pTail;
+        }
+
+        return nullptr;
+    }
+
+    inline bool AsyncWriter::IsEmpty() const noexcept {
+        return ((this->m_tail == &this->m_stub) && (this->m_stub.Next.load() == nullptr) && (this->m_head.load() == &this->m_stub));
+    }
+
+    inline bool AsyncWriter::Wait(const std::chrono::steady_clock::time_point deadline) {
+
+        this->m_sleeping.store(true);
+
+        std::unique_lock<std::mutex> lock(this->m_mutex);
+        const auto ready = [this] () { return (this->m_stopping.load() || !this->IsEmpty()); };
+
+        const bool res = ((deadline == std::chrono::steady_clock::time_point::max())
+            ? (this->m_wakeup.wait(lock, ready), true)
+            : this->m_wakeup.wait_until(lock, deadline, ready));
+
+        this->m_sleeping.store(false);
+
+        return res;
+    }
+
+    inline void AsyncWriter::Run() {
+
+        std::vector<std::unique_ptr<Job>> batch = { };
+        batch.reserve(this->m_options.MaxBatchSize);
+
+        while (true) {
+
+            Job* pJob = this->Pop();
+            if (!pJob) {
+                if (this->m_stopping.load() && this->IsEmpty()) break;
+                this->Wait(std::chrono::steady_clock::time_point::max());
+                continue;
+            }
+
+            batch.emplace_back(pJob);
+            const auto deadline = (std::chrono::steady_clock::now() + this->m_options.MaxLatency);
+
+            while (batch.size() < this->m_options.MaxBatchSize) {
+
+                pJob = this->Pop();
+                if (pJob) {
+                    batch.emplace_back(pJob);
+                    continue;
+                }
+
+                if (this->m_stopping.load() || !this->Wait(deadline)) break;
+
+            }
+
+            this->Commit(batch);
+            batch.clear();
+
+        }
+
+    }
+
+    inline void AsyncWriter::Commit(std::vector<std::unique_ptr<Job>>& batch) {
+
+        std::exception_ptr error = nullptr;
+
+        try {
+
+            Transaction transaction(this->m_database, TransactionMode::Immediate);
+
+            for (std::unique_ptr<Job>& job : batch) {
+
+                Savepoint savepoint(this->m_database, "vsqlite_job");
+
+                try {
+                    job->Work(this->m_database);
+                    savepoint.Release();
+                }
+                catch (...) {
+                    job->Error = std::current_exception();
+                    savepoint.Rollback();
+                }
+
+            }
+
+            transaction.Commit();
+
+        }
+        catch (...) {
+            error = std::current_exception();
+        }
+
+        // Counted first, so that the statistics include a batch once its futures are ready.
+        this->m_jobs.fetch_add(batch.size(), std::memory_order_relaxed);
+        this->m_batches.fetch_add(1, std::memory_order_relaxed);
+
+        for (std::unique_ptr<Job>& job : batch) {
+            if (error) job->Promise.set_exception(error);
+            else if (job->Error) job->Promise.set_exception(job->Error);
+            else job->Promise.set_value();
+        }
+
+    }
+
+    inline std::future<void> AsyncWriter::Submit(std::function<void(Database&)> work) {
+
+        std::unique_ptr<Job> job = std::make_unique<Job>();
+        job->Work = std::move(work);
+        std::future<void> future = job->Promise.get_future();
+
+        this->Push(job.release());
+
+        if (this->m_sleeping.load()) {
+            const std::lock_guard<std::mutex> lock(this->m_mutex);
+            this->m_wakeup.notify_one();
+        }
+
+        return future;
+    }
+
+    template <typename... Args>
+    inline std::future<void> AsyncWriter::Execute(const std::string_view sql, Args&&... args) {
+        return this->Submit([sql = std::string(sql), ...args = std::forward<Args>(args)] (Database& database) {
+            database.Cached(sql)->Execute(args...);
+        });
+    }
+
+    inline AsyncWriterStatistics AsyncWriter::GetStatistics() const {
+        return { this->m_jobs.load(std::memory_order_relaxed), this->m_batches.load(std::memory_order_relaxed) };
+    }
+
+}
+
+#endif // _VSQLITE_ASYNCWRITER_H_
\ No newline at end of file
@@ -0,0 +1,459 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#ifndef _VSQLITE_BACKUP_H_
+#define _VSQLITE_BACKUP_H_
+
+#include <Vsqlite/SQLite.h>
+#include <Vsqlite/SqliteException.h>
+#include <Vsqlite/Database.h>
+
+#include <string>
+#include <string_view>
+#include <span>
+#include <optional>
+#include <functional>
+#include <chrono>
+#include <thread>
+#include <stdexcept>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+namespace Vsqlite {
+
+    /**
+     * Backup progress, reported after every step.
+     */
+    struct BackupProgress {
+
+        /**
+         * Number of pages still to be copied.
+         */
+        std::int32_t Remaining;
+
+        /**
+         * Number of pages in the source database.
+         */
+        std::int32_t PageCount;
+
+        /**
+         * Returns the fraction of pages copied.
+         *
+         * @returns A number between 0 and 1.
+         */
+        double GetFraction(void) const {
+            if (this->PageCount <= 0) return 1.00;
+            return (static_cast<double>(this->PageCount - this->Remaining) / this->PageCount);
+        }
+
+    };
+
+    /**
+     * Controls how a Backup copies pages.
+     */
+    struct BackupOptions {
+
+        /**
+         * Number of pages copied per step. The source is only locked during a step.
+         * A negative value copies the whole database in one step.
+         */
+        std::int32_t PagesPerStep = 256;
+
+        /**
+         * Time to wait between steps, so that writers can use the source database.
+         * Zero only yields the thread.
+         */
+        std::chrono::milliseconds StepDelay = std::chrono::milliseconds(1);
+
+        /**
+         * How long a step may keep failing because a database is busy or locked.
+         */
+        std::chrono::milliseconds BusyTimeout = std::chrono::milliseconds(5000);
+
+        /**
+         * Called after every step.
+         */
+        std::function<void(const BackupProgress&)> OnProgress = nullptr;
+
+    };
+
+    /**
+     * Represents an online backup that copies one database into another page by page,
+     * while the source remains usable.
+     *
+     * If the source is modified between steps through a connection other than the
+     * one the backup reads from, the backup restarts from the beginning.
+     */
+    class Backup {
+
+    private:
+        sqlite3_backup* m_pBackup;
+        sqlite3* m_pDestination;
+        bool m_done;
+        bool m_busy;
+
+    public:
+
+        /**
+         * Starts a backup.
+         *
+         * @param destination The database to copy into. Its contents are replaced.
+         * @param source The database to copy from.
+         * @param destinationSchema Name of the destination schema.
+         * @param sourceSchema Name of the source schema.
+         * @exception std::invalid_argument - A schema name is an empty string.
+         * @exception SqliteException
+         */
+        Backup(Database& destination, const Database& source, const std::string_view destinationSchema = "main", const std::string_view sourceSchema = "main");
+
+        Backup(const Backup&) = delete;
+        Backup(Backup&&) = delete;
+
+        /**
+         * Finishes the backup, releasing its locks.
+         */
+        virtual ~Backup(void);
+
+        Backup& operator= (const Backup&) = delete;
+        Backup& operator= (Backup&&) = delete;
+
+        /**
+         * Copies up to the given number of pages.
+         *
+         * @param pages Number of pages. A negative value copies all remaining pages.
+         * @returns true if the backup is complete; false if pages remain or a database was busy.
+         * @exception std::logic_error - The backup is finished.
+         * @exception SqliteException
+         */
+        bool Step(const std::int32_t pages);
+
+        /**
+         * Copies all remaining pages, step by step.
+         *
+         * @param options Step size, delays and progress callback.
+         * @exception std::logic_error - The backup is finished.
+         * @exception SqliteException - A step failed, or a database stayed busy for longer than options.BusyTimeout.
+         */
+        void Run(const BackupOptions& options = { });
+
+        /**
+         * Finishes the backup.
+         *
+         * @exception SqliteException - A step failed.
+         */
+        void Finish(void);
+
+        BackupProgress GetProgress(void) const;
+        bool IsDone(void) const;
+
+        /**
+         * Copies a database into a file.
+         *
+         * @param source The database to copy from.
+         * @param filename Path of the destination file. Its contents are replaced.
+         * @param options Step size, delays and progress callback.
+         * @exception std::invalid_argument - The 'filename' parameter is an empty string.
+         * @exception SqliteException
+         */
+        static void ToFile(const Database& source, const std::string_view filename, const BackupOptions& options = { });
+
+        /**
+         * Copies a database into a new in-memory database.
+         *
+         * @param source The database to copy from.
+         * @param options Step size, delays and progress callback.
+         * @returns The in-memory database.
+         * @exception SqliteException
+         */
+        static Database ToMemory(const Database& source, const BackupOptions& options = { });
+
+    };
+
+    /**
+     * Represents a serialized database image: the exact bytes of the database file.
+     */
+    class SerializedDatabase {
+
+    private:
+        unsigned char* m_pData;
+        std::int64_t m_size;
+
+    public:
+        SerializedDatabase(void);
+
+        /**
+         * Constructs a new SerializedDatabase object that takes ownership of memory allocated by SQLite.
+         *
+         * @param pData Memory allocated with sqlite3_malloc64.
+         * @param size Number of bytes.
+         */
+        SerializedDatabase(unsigned char* const pData, const std::int64_t size);
+
+        SerializedDatabase(const SerializedDatabase&) = delete;
+        SerializedDatabase(SerializedDatabase&& image) noexcept;
+        virtual ~SerializedDatabase(void);
+
+        SerializedDatabase& operator= (const SerializedDatabase&) = delete;
+        SerializedDatabase& operator= (SerializedDatabase&& image) noexcept;
+
+        std::span<const std::byte> GetData(void) const;
+        std::int64_t GetSize(void) const;
+
+        /**
+         * Releases ownership of the memory.
+         *
+         * @returns Memory that must be freed with sqlite3_free.
+         */
+        unsigned char* Release(void);
+
+    };
+
+    inline Backup::Backup(Database& destination, const Database& source, const std::string_view destinationSchema, const std::string_view sourceSchema)
+        : m_pBackup(nullptr), m_pDestination(destination.GetDatabaseHandle()), m_done(false), m_busy(false) {
+
+        if (destinationSchema.empty())
+            throw std::invalid_argument("'destinationSchema': Empty string.");
+
+        if (sourceSchema.empty())
+            throw std::invalid_argument("'sourceSchema': Empty string.");
+
+        this->m_pBackup = sqlite3_backup_init(
+            this->m_pDestination,
+            std::string(destinationSchema).c_str(),
+            source.GetDatabaseHandle(),
+            std::string(sourceSchema).c_str()
+        );
+
+        if (!this->m_pBackup) throw SqliteException(this->m_pDestination);
+
+    }
+
+    inline Backup::~Backup() {
+
+        if (this->m_pBackup) {
+            sqlite3_backup_finish(this->m_pBackup);
+            this->m_pBackup = nullptr;
+        }
+
+    }
+
+    inline bool Backup::Step(const std::int32_t pages) {
+
+        if (!this->m_pBackup)
+            throw std::logic_error("Backup::Step(): The backup is finished.");
+
+        if (this->m_done) return true;
+
+        const std::int32_t res = sqlite3_backup_step(this->m_pBackup, pages);
+        this->m_busy = ((res == SQLITE_BUSY) || (res == SQLITE_LOCKED));
+
+        if (res == SQLITE_DONE) {
+            this->m_done = true;
+            return true;
+        }
+
+        if ((res == SQLITE_OK) || this->m_busy) return false;
+
+        throw SqliteException(sqlite3_errstr(res), (res & 0xFF), res);
+    }
+
+    inline void Backup::Run(const BackupOptions& options) {
+
+        if (!this->m_pBackup)
+            throw std::logic_error("Backup::Run(): The backup is finished.");
+
+        std::optional<std::chrono::steady_clock::time_point> busySince = std::nullopt;
+
+        while (true) {
+
+            const bool done = this->Step(options.PagesPerStep);
+
+            if (options.OnProgress) options.OnProgress(this->GetProgress());
+            if (done) break;
+
+            // The remaining page count is only known after the first successful step,
+            // so a busy database is detected from the step result instead.
+            if (this->m_busy) {
+                const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+                if (!busySince.has_value()) busySince = now;
+                else if ((now - busySince.value()) > options.BusyTimeout)
+                    throw SqliteException("Backup::Run(): The database is busy.", SQLITE_BUSY, SQLITE_BUSY);
+            }
+            else busySince = std::nullopt;
+
+            if (options.StepDelay.count() > 0) std::this_thread::sleep_for(options.StepDelay);
+            else std::this_thread::yield();
+
+        }
+
+    }
+
+    inline void Backup::Finish() {
+
+        if (!this->m_pBackup) return;
+
+        const std::int32_t res = sqlite3_backup_finish(this->m_pBackup);
+        this->m_pBackup = nullptr;
+
+        if (res != SQLITE_OK) throw SqliteException(this->m_pDestination);
+
+    }
+
+    inline BackupProgress Backup::GetProgress() const {
+        if (!this->m_pBackup) return { 0, 0 };
+        return { sqlite3_backup_remaining(this->m_pBackup), sqlite3_backup_pagecount(this->m_pBackup) };
+    }
+
+    inline bool Backup::IsDone() const {
+        return this->m_done;
+    }
+
+    inline void Backup::ToFile(const Database& source, const std::string_view filename, const BackupOptions& options) {
+
+        if (filename.empty())
+            throw std::invalid_argument("'filename': Empty string.");
+
+        Database destination = { filename, (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+
+        Backup backup = { destination, source };
+        backup.Run(options);
+        backup.Finish();
+
+    }
+
+    inline Database Backup::ToMemory(const Database& source, const BackupOptions& options) {
+
+        Database destination = { std::nullopt, (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_MEMORY) };
+
+        {
+            Backup backup = { destination, source };
+            backup.Run(options);
+            backup.Finish();
+        }
+
+        return destination;
+    }
+
+    inline SerializedDatabase::SerializedDatabase() : m_pData(nullptr), m_size(0) { }
+
+    inline SerializedDatabase::SerializedDatabase(unsigned char* const pData, const std::int64_t size) : m_pData(pData), m_size(size) { }
+
+    inline SerializedDatabase::SerializedDatabase(SerializedDatabase&& image) noexcept : m_pData(nullptr), m_size(0) {
+        this->operator= (std::move(image));
+    }
+
+    inline SerializedDatabase::~SerializedDatabase() {
+
+        if (this->m_pData) {
+            sqlite3_free(this->m_pData);
+            this->m_pData = nullptr;
+        }
+
+    }
+
+    inline SerializedDatabase& SerializedDatabase::operator= (SerializedDatabase&& image) noexcept {
+
+        if (this != &image) {
+
+            if (this->m_pData) sqlite3_free(this->m_pData);
+
+            this->m_pData = image.m_pData;
+            this->m_size = image.m_size;
+            image.m_pData = nullptr;
+            image.m_size = 0;
+
+        }
+
+        return static_cast<SerializedDatabase&>(*this);
+    }
+
+    inline std::span<const std::byte> SerializedDatabase::GetData() const {
+        return { reinterpret_cast<const std::byte*>(this->m_pData), static_cast<std::size_t>(this->m_size) };
+    }
+
+    inline std::int64_t SerializedDatabase::GetSize() const {
+        return this->m_size;
+    }
+
+    inline unsigned char* SerializedDatabase::Release() {
+        unsigned char* pData = this->m_pData;
+        this->m_pData = nullptr;
+        this->m_size = 0;
+        return pData;
+    }
+
+    inline SerializedDatabase Database::Serialize(const std::string_view schema) const {
+
+        if (schema.empty())
+            throw std::invalid_argument("'schema': Empty string.");
+
+        sqlite3_int64 size = 0;
+        unsigned char* pData = sqlite3_serialize(this->m_pDatabase, std::string(schema).c_str(), &size, 0);
+
+        if (!pData && !sqlite3_db_filename(this->m_pDatabase, std::string(schema).c_str()))
+            throw std::invalid_argument("'schema': No such schema.");
+
+        // An empty database serializes to zero bytes.
+        if (!pData && (size != 0))
+            throw SqliteException("Database::Serialize(): Out of memory.", SQLITE_NOMEM, SQLITE_NOMEM);
+
+        return SerializedDatabase(pData, size);
+    }
+
+    inline std::span<const std::byte> Database::SerializeNoCopy(const std::string_view schema) const {
+
+        if (schema.empty())
+            throw std::invalid_argument("'schema': Empty string.");
+
+        sqlite3_int64 size = 0;
+        const unsigned char* pData = sqlite3_serialize(this->m_pDatabase, std::string(schema).c_str(), &size, SQLITE_SERIALIZE_NOCOPY);
+        if (!pData) return { };
+
+        return { reinterpret_cast<const std::byte*>(pData), static_cast<std::size_t>(size) };
+    }
+
+    inline void Database::Deserialize(SerializedDatabase&& image, const std::string_view schema, const bool readOnly) {
+
+        if (schema.empty())
+            throw std::invalid_argument("'schema': Empty string.");
+
+        const std::int64_t size = image.GetSize();
+        unsigned char* pData = image.Release();
+
+        // Images of WAL databases must be switched to rollback journal mode (file format
+        // read/write versions at offsets 18 and 19), since in-memory databases cannot use WAL.
+        if ((size >= 20) && (pData[18] == 2) && (pData[19] == 2)) {
+            pData[18] = 1;
+            pData[19] = 1;
+        }
+
+        const std::uint32_t flags = (SQLITE_DESERIALIZE_FREEONCLOSE | (readOnly ? SQLITE_DESERIALIZE_READONLY : SQLITE_DESERIALIZE_RESIZEABLE));
+
+        // SQLite frees the buffer on failure as well.
+        const std::int32_t res = sqlite3_deserialize(this->m_pDatabase, std::string(schema).c_str(), pData, size, size, flags);
+        if (res != SQLITE_OK) throw SqliteException(this->m_pDatabase);
+
+    }
+
+    inline void Database::Deserialize(const std::span<const std::byte> image, const std::string_view schema, const bool readOnly) {
+
+        if (schema.empty())
+            throw std::invalid_argument("'schema': Empty string.");
+
+        unsigned char* pData = static_cast<unsigned char*>(sqlite3_malloc64(image.size()));
+        if (!pData && !image.empty())
+            throw SqliteException("Database::Deserialize(): Out of memory.", SQLITE_NOMEM, SQLITE_NOMEM);
+
+        if (!image.empty()) std::memcpy(pData, image.data(), image.size());
+
+        this->Deserialize(SerializedDatabase(pData, static_cast<std::int64_t>(image.size())), schema, readOnly);
+
+    }
+
+}
+
+#endif // _VSQLITE_BACKUP_H_
\ No newline at end of file
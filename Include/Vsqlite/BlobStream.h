@@ -0,0 +1,336 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#ifndef _VSQLITE_BLOBSTREAM_H_
+#define _VSQLITE_BLOBSTREAM_H_
+
+#include <Vsqlite/SQLite.h>
+#include <Vsqlite/SqliteException.h>
+
+#include <string>
+#include <string_view>
+#include <span>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <stdexcept>
+
+namespace Vsqlite {
+
+    class Database;
+
+    /**
+     * Represents an open BLOB that can be read and written incrementally.
+     */
+    class BlobStream {
+
+    private:
+        sqlite3* m_pDatabase;
+        sqlite3_blob* m_pBlob;
+        std::int32_t m_size;
+        std::int32_t m_position;
+
+    public:
+
+        /**
+         * Constructs a new BlobStream object.
+         *
+         * @param database An SQLite database.
+         * @param table Name of the table containing the BLOB.
+         * @param column Name of the column containing the BLOB.
+         * @param rowid Rowid of the row containing the BLOB.
+         * @param writable If true, the BLOB is opened for reading and writing; otherwise, it is opened read-only.
+         * @param schema Name of the database containing the table ("main", "temp" or an attached database).
+         * @exception std::invalid_argument - The 'table', 'column' or 'schema' parameter is an empty string.
+         * @exception SqliteException
+         */
+        BlobStream(
+            const Database& database,
+            const std::string_view table,
+            const std::string_view column,
+            const std::int64_t rowid,
+            const bool writable,
+            const std::string_view schema = "main"
+        );
+
+        /**
+         * Constructs a new BlobStream object.
+         *
+         * @param pDatabase An SQLite database.
+         * @param table Name of the table containing the BLOB.
+         * @param column Name of the column containing the BLOB.
+         * @param rowid Rowid of the row containing the BLOB.
+         * @param writable If true, the BLOB is opened for reading and writing; otherwise, it is opened read-only.
+         * @param schema Name of the database containing the table ("main", "temp" or an attached database).
+         * @exception std::invalid_argument - The 'table', 'column' or 'schema' parameter is an empty string.
+         * @exception SqliteException
+         */
+        BlobStream(
+            sqlite3* const pDatabase,
+            const std::string_view table,
+            const std::string_view column,
+            const std::int64_t rowid,
+            const bool writable,
+            const std::string_view schema = "main"
+        );
+
+        BlobStream(const BlobStream&) = delete;
+        BlobStream(BlobStream&& stream) noexcept;
+        virtual ~BlobStream(void);
+
+        BlobStream& operator= (const BlobStream&) = delete;
+        BlobStream& operator= (BlobStream&& stream) noexcept;
+
+        /**
+         * Returns the SQLite BLOB handle.
+         *
+         * @returns sqlite3_blob*
+         */
+        sqlite3_blob* GetBlobHandle(void) const;
+
+        /**
+         * Returns the size of the BLOB in bytes.
+         *
+         * @returns An integer.
+         */
+        std::int32_t GetSize(void) const;
+
+        /**
+         * Returns the current read/write position.
+         *
+         * @returns An integer.
+         */
+        std::int32_t GetPosition(void) const;
+
+        /**
+         * Sets the current read/write position.
+         *
+         * @param position An offset from the start of the BLOB.
+         * @exception std::out_of_range - The 'position' parameter is past the end of the BLOB.
+         */
+        void Seek(const std::int32_t position);
+
+        /**
+         * Reads bytes from the current position and advances the position.
+         *
+         * @param buffer A buffer that receives the data.
+         * @returns The number of bytes read. Zero if the end of the BLOB has been reached.
+         * @exception SqliteException
+         */
+        std::size_t Read(const std::span<std::byte> buffer);
+
+        /**
+         * Reads exactly buffer.size() bytes starting at the given offset.
+         * The current position is not changed.
+         *
+         * @param buffer A buffer that receives the data.
+         * @param offset An offset from the start of the BLOB.
+         * @exception std::out_of_range - The requested range is past the end of the BLOB.
+         * @exception SqliteException
+         */
+        void ReadAt(const std::span<std::byte> buffer, const std::int32_t offset) const;
+
+        /**
+         * Writes bytes at the current position and advances the position.
+         * BLOBs cannot be resized; use ZeroBlob to reserve space beforehand.
+         *
+         * @param data The data to write.
+         * @exception std::out_of_range - The data does not fit into the BLOB.
+         * @exception SqliteException
+         */
+        void Write(const std::span<const std::byte> data);
+
+        /**
+         * Writes bytes starting at the given offset.
+         * The current position is not changed.
+         *
+         * @param data The data to write.
+         * @param offset An offset from the start of the BLOB.
+         * @exception std::out_of_range - The data does not fit into the BLOB.
+         * @exception SqliteException
+         */
+        void WriteAt(const std::span<const std::byte> data, const std::int32_t offset);
+
+        /**
+         * Moves the stream to the BLOB in another row of the same table and column.
+         * This is considerably faster than opening a new BlobStream. The position is reset to zero.
+         * If the row cannot be opened, the stream is left empty until it is reopened successfully.
+         *
+         * @param rowid Rowid of the row containing the BLOB.
+         * @exception SqliteException
+         */
+        void Reopen(const std::int64_t rowid);
+
+    };
+
+    inline BlobStream::BlobStream(
+        sqlite3* const pDatabase,
+        const std::string_view table,
+        const std::string_view column,
+        const std::int64_t rowid,
+        const bool writable,
+        const std::string_view schema
+    ) {
+
+        if (table.empty())
+            throw std::invalid_argument("'table': Empty string.");
+
+        if (column.empty())
+            throw std::invalid_argument("'column': Empty string.");
+
+        if (schema.empty())
+            throw std::invalid_argument("'schema': Empty string.");
+
+        const std::int32_t res = sqlite3_blob_open(
+            pDatabase,
+            std::string(schema).c_str(),
+            std::string(table).c_str(),
+            std::string(column).c_str(),
+            rowid,
+            (writable ? 1 : 0),
+            &this->m_pBlob
+        );
+
+        if (res != SQLITE_OK) {
+            const SqliteException ex = { pDatabase };
+            sqlite3_blob_close(this->m_pBlob);
+            this->m_pBlob = nullptr;
+            throw ex;
+        }
+
+        this->m_pDatabase = pDatabase;
+        this->m_size = sqlite3_blob_bytes(this->m_pBlob);
+        this->m_position = 0;
+
+    }
+
+    inline BlobStream::BlobStream(BlobStream&& stream) noexcept {
+        this->m_pBlob = nullptr;
+        this->operator= (std::move(stream));
+    }
+
+    inline BlobStream::~BlobStream() {
+
+        if (this->m_pBlob) {
+            sqlite3_blob_close(this->m_pBlob);
+            this->m_pBlob = nullptr;
+        }
+
+    }
+
+    inline BlobStream& BlobStream::operator= (BlobStream&& stream) noexcept {
+
+        if (this != &stream) {
+
+            if (this->m_pBlob) {
+                sqlite3_blob_close(this->m_pBlob);
+                this->m_pBlob = nullptr;
+            }
+
+            this->m_pDatabase = stream.m_pDatabase;
+            this->m_pBlob = stream.m_pBlob;
+            this->m_size = stream.m_size;
+            this->m_position = stream.m_position;
+            stream.m_pBlob = nullptr;
+            stream.m_size = 0;
+            stream.m_position = 0;
+
+        }
+
+        return static_cast<BlobStream&>(*this);
+    }
+
+    inline sqlite3_blob* BlobStream::GetBlobHandle() const {
+        return this->m_pBlob;
+    }
+
+    inline std::int32_t BlobStream::GetSize() const {
+        return this->m_size;
+    }
+
+    inline std::int32_t BlobStream::GetPosition() const {
+        return this->m_position;
+    }
+
+    inline void BlobStream::Seek(const std::int32_t position) {
+
+        if ((position < 0) || (position > this->m_size))
+            throw std::out_of_range("'position': Out of range.");
+
+        this->m_position = position;
+
+    }
+
+    inline std::size_t BlobStream::Read(const std::span<std::byte> buffer) {
+
+        const std::size_t remaining = static_cast<std::size_t>(this->m_size - this->m_position);
+        const std::size_t count = std::min(buffer.size(), remaining);
+        if (count == 0) return 0;
+
+        this->ReadAt(buffer.first(count), this->m_position);
+        this->m_position += static_cast<std::int32_t>(count);
+
+        return count;
+    }
+
+    inline void BlobStream::ReadAt(const std::span<std::byte> buffer, const std::int32_t offset) const {
+
+        if ((offset < 0) || (offset > this->m_size) || (buffer.size() > static_cast<std::size_t>(this->m_size - offset)))
+            throw std::out_of_range("BlobStream::ReadAt(): Out of range.");
+
+        const std::int32_t res = sqlite3_blob_read(this->m_pBlob, buffer.data(), static_cast<std::int32_t>(buffer.size()), offset);
+        if (res != SQLITE_OK) throw SqliteException(this->m_pDatabase);
+
+    }
+
+    inline void BlobStream::Write(const std::span<const std::byte> data) {
+        this->WriteAt(data, this->m_position);
+        this->m_position += static_cast<std::int32_t>(data.size());
+    }
+
+    inline void BlobStream::WriteAt(const std::span<const std::byte> data, const std::int32_t offset) {
+
+        if ((offset < 0) || (offset > this->m_size) || (data.size() > static_cast<std::size_t>(this->m_size - offset)))
+            throw std::out_of_range("BlobStream::WriteAt(): Out of range.");
+
+        const std::int32_t res = sqlite3_blob_write(this->m_pBlob, data.data(), static_cast<std::int32_t>(data.size()), offset);
+        if (res != SQLITE_OK) throw SqliteException(this->m_pDatabase);
+
+    }
+
+    inline void BlobStream::Reopen(const std::int64_t rowid) {
+
+        const std::int32_t res = sqlite3_blob_reopen(this->m_pBlob, rowid);
+        this->m_position = 0;
+
+        // A failed reopen aborts the handle; it must not keep the previous row's size.
+        if (res != SQLITE_OK) {
+            this->m_size = 0;
+            throw SqliteException(this->m_pDatabase);
+        }
+
+        this->m_size = sqlite3_blob_bytes(this->m_pBlob);
+
+    }
+
+}
+
+#include <Vsqlite/Database.h>
+
+namespace Vsqlite {
+
+    inline BlobStream::BlobStream(
+        const Database& database,
+        const std::string_view table,
+        const std::string_view column,
+        const std::int64_t rowid,
+        const bool writable,
+        const std::string_view schema
+    ) : BlobStream(database.GetDatabaseHandle(), table, column, rowid, writable, schema) { }
+
+}
+
+#endif // _VSQLITE_BLOBSTREAM_H_
\ No newline at end of file
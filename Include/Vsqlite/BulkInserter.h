@@ -0,0 +1,295 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#ifndef _VSQLITE_BULKINSERTER_H_
+#define _VSQLITE_BULKINSERTER_H_
+
+#include <Vsqlite/SQLite.h>
+#include <Vsqlite/SqliteException.h>
+#include <Vsqlite/Database.h>
+#include <Vsqlite/Statement.h>
+
+#include <string_view>
+#include <span>
+#include <tuple>
+#include <optional>
+#include <ranges>
+#include <chrono>
+#include <exception>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+namespace Vsqlite {
+
+    /**
+     * Controls how a BulkInserter groups rows into transactions.
+     */
+    struct BulkInsertOptions {
+
+        /**
+         * Maximum number of rows per transaction.
+         */
+        std::size_t RowsPerTransaction = 1000;
+
+        /**
+         * Approximate maximum number of bound bytes per transaction. Zero disables the limit.
+         */
+        std::size_t BytesPerTransaction = 0;
+
+    };
+
+    /**
+     * BulkInserter counters.
+     */
+    struct BulkInsertStatistics {
+
+        std::uint64_t Rows;
+        std::uint64_t Transactions;
+
+        /**
+         * Approximate number of bound bytes. Only counted when BytesPerTransaction is set.
+         */
+        std::uint64_t Bytes;
+
+        /**
+         * Time from the first inserted row to the last commit.
+         */
+        std::chrono::nanoseconds Elapsed;
+
+        /**
+         * Returns the insert throughput.
+         *
+         * @returns Rows per second.
+         */
+        double GetRowsPerSecond(void) const {
+            if (this->Elapsed.count() <= 0) return 0.00;
+            return (static_cast<double>(this->Rows) / std::chrono::duration<double>(this->Elapsed).count());
+        }
+
+    };
+
+    /**
+     * Inserts rows through a single prepared statement, committing every N rows.
+     *
+     * If the database is already inside a transaction, rows are inserted into it
+     * and no transactions are started or committed.
+     */
+    class BulkInserter {
+
+    private:
+        Database* m_pDatabase;
+        Statement m_statement;
+        BulkInsertOptions m_options;
+        bool m_inTransaction;
+        std::int32_t m_uncaughtExceptions;
+        std::size_t m_pendingRows;
+        std::size_t m_pendingBytes;
+        BulkInsertStatistics m_statistics;
+        std::chrono::steady_clock::time_point m_start;
+
+        void Begin(void);
+
+        template <typename T>
+        static std::size_t GetSize(const T& arg);
+
+        template <typename T>
+        static std::size_t GetSize(const std::optional<T>& arg);
+
+        template <typename T>
+        static std::size_t GetSize(const Borrowed<T>& arg);
+
+    public:
+
+        /**
+         * Constructs a new BulkInserter object.
+         *
+         * @param database An SQLite database.
+         * @param sql An INSERT statement.
+         * @param options Transaction chunking options.
+         * @exception std::invalid_argument - The 'sql' parameter is an empty string,
+         * or options.RowsPerTransaction is zero.
+         * @exception SqliteException
+         */
+        BulkInserter(Database& database, const std::string_view sql, const BulkInsertOptions& options = { });
+
+        BulkInserter(const BulkInserter&) = delete;
+        BulkInserter(BulkInserter&&) = delete;
+
+        /**
+         * Commits pending rows. If the object is destroyed during stack unwinding,
+         * pending rows are rolled back instead. Call Commit to observe commit errors.
+         */
+        virtual ~BulkInserter(void);
+
+        BulkInserter& operator= (const BulkInserter&) = delete;
+        BulkInserter& operator= (BulkInserter&&) = delete;
+
+        /**
+         * Inserts a row.
+         *
+         * @tparam Args...
+         * @param args Parameter values.
+         * @exception std::invalid_argument
+         * @exception SqliteException
+         */
+        template <typename... Args>
+        void Insert(const Args&... args);
+
+        /**
+         * Inserts a row.
+         *
+         * @tparam Args...
+         * @param row Parameter values.
+         * @exception std::invalid_argument
+         * @exception SqliteException
+         */
+        template <typename... Args>
+        void Insert(const std::tuple<Args...>& row);
+
+        /**
+         * Commits pending rows.
+         *
+         * @exception SqliteException
+         */
+        void Commit(void);
+
+        /**
+         * Returns the insert counters.
+         *
+         * @returns A BulkInsertStatistics.
+         */
+        BulkInsertStatistics GetStatistics(void) const;
+
+    };
+
+    inline BulkInserter::BulkInserter(Database& database, const std::string_view sql, const BulkInsertOptions& options)
+        : m_pDatabase(&database), m_statement(database, sql, SQLITE_PREPARE_PERSISTENT), m_options(options) {
+
+        if (options.RowsPerTransaction == 0)
+            throw std::invalid_argument("'options': RowsPerTransaction must be greater than zero.");
+
+        this->m_inTransaction = false;
+        this->m_uncaughtExceptions = std::uncaught_exceptions();
+        this->m_pendingRows = 0;
+        this->m_pendingBytes = 0;
+        this->m_statistics = { 0, 0, 0, std::chrono::nanoseconds::zero() };
+
+    }
+
+    inline BulkInserter::~BulkInserter() {
+
+        if (!this->m_inTransaction) return;
+
+        try {
+            if (std::uncaught_exceptions() > this->m_uncaughtExceptions) this->m_pDatabase->Cached("ROLLBACK")->Execute();
+            else this->Commit();
+        }
+        catch (...) {
+            if (!sqlite3_get_autocommit(this->m_pDatabase->GetDatabaseHandle()))
+                sqlite3_exec(this->m_pDatabase->GetDatabaseHandle(), "ROLLBACK", nullptr, nullptr, nullptr);
+        }
+
+    }
+
+    inline void BulkInserter::Begin() {
+
+        if (this->m_statistics.Rows == 0)
+            this->m_start = std::chrono::steady_clock::now();
+
+        if (sqlite3_get_autocommit(this->m_pDatabase->GetDatabaseHandle())) {
+            this->m_pDatabase->Cached("BEGIN")->Execute();
+            this->m_inTransaction = true;
+        }
+
+    }
+
+    template <typename T>
+    inline std::size_t BulkInserter::GetSize(const T& arg) {
+
+        if constexpr (std::is_convertible_v<const T&, std::string_view>) return std::string_view(arg).length();
+        else if constexpr (std::is_convertible_v<const T&, std::span<const std::byte>>) return std::span<const std::byte>(arg).size();
+        else return sizeof(T);
+
+    }
+
+    template <typename T>
+    inline std::size_t BulkInserter::GetSize(const std::optional<T>& arg) {
+        return (arg.has_value() ? GetSize(arg.value()) : 0);
+    }
+
+    template <typename T>
+    inline std::size_t BulkInserter::GetSize(const Borrowed<T>& arg) {
+        return GetSize(arg.Get());
+    }
+
+    template <typename... Args>
+    inline void BulkInserter::Insert(const Args&... args) {
+
+        if (!this->m_inTransaction) this->Begin();
+
+        if ((0 + ... + ParameterCount<Args>) == static_cast<std::size_t>(this->m_statement.GetParameterCount())) this->m_statement.ExecuteRebind(args...);
+        else this->m_statement.Execute(args...);
+
+        ++this->m_pendingRows;
+        ++this->m_statistics.Rows;
+
+        if (this->m_options.BytesPerTransaction != 0) {
+            const std::size_t bytes = (0 + ... + GetSize(args));
+            this->m_pendingBytes += bytes;
+            this->m_statistics.Bytes += bytes;
+        }
+
+        if ((this->m_pendingRows >= this->m_options.RowsPerTransaction) ||
+            ((this->m_options.BytesPerTransaction != 0) && (this->m_pendingBytes >= this->m_options.BytesPerTransaction))) {
+            this->Commit();
+        }
+
+    }
+
+    template <typename... Args>
+    inline void BulkInserter::Insert(const std::tuple<Args...>& row) {
+        std::apply([this] (const Args&... args) { this->Insert(args...); }, row);
+    }
+
+    inline void BulkInserter::Commit() {
+
+        if (this->m_inTransaction) {
+            this->m_pDatabase->Cached("COMMIT")->Execute();
+            this->m_inTransaction = false;
+            ++this->m_statistics.Transactions;
+        }
+
+        this->m_pendingRows = 0;
+        this->m_pendingBytes = 0;
+
+        if (this->m_statistics.Rows != 0)
+            this->m_statistics.Elapsed = (std::chrono::steady_clock::now() - this->m_start);
+
+    }
+
+    inline BulkInsertStatistics BulkInserter::GetStatistics() const {
+        return this->m_statistics;
+    }
+
+    template <std::ranges::input_range R>
+    inline BulkInsertStatistics Database::InsertMany(const std::string_view sql, R&& rows, const BulkInsertOptions& options) {
+
+        BulkInserter inserter = { static_cast<Database&>(*this), sql, options };
+        for (const auto& row : rows) inserter.Insert(row);
+        inserter.Commit();
+
+        return inserter.GetStatistics();
+    }
+
+    template <std::ranges::input_range R>
+    inline BulkInsertStatistics Database::InsertMany(const std::string_view sql, R&& rows) {
+        return this->InsertMany(sql, std::forward<R>(rows), BulkInsertOptions { });
+    }
+
+}
+
+#endif // _VSQLITE_BULKINSERTER_H_
\ No newline at end of file
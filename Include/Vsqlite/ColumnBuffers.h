@@ -0,0 +1,198 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#ifndef _VSQLITE_COLUMNBUFFERS_H_
+#define _VSQLITE_COLUMNBUFFERS_H_
+
+#include <Vsqlite/SQLite.h>
+#include <Vsqlite/DataBinding.h>
+#include <Vsqlite/Statement.h>
+
+#include <array>
+#include <tuple>
+#include <vector>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+
+namespace Vsqlite {
+
+    /**
+     * Stores result rows column by column, in contiguous per-column arrays.
+     *
+     * Every column has a validity bitmap in which bit (row % 8) of byte (row / 8)
+     * is set if the value is not NULL. NULL values are stored as value-initialized T.
+     *
+     * @tparam Ts... Column types.
+     */
+    template <typename... Ts>
+    class ColumnBuffers {
+
+        static_assert(((!std::is_same_v<Ts, bool>) && ...), "ColumnBuffers: use std::uint8_t instead of bool.");
+        static_assert(((!std::is_same_v<Ts, std::string_view>) && ...), "ColumnBuffers: std::string_view does not outlive the row.");
+        static_assert(((!std::is_same_v<Ts, std::span<const std::byte>>) && ...), "ColumnBuffers: std::span does not outlive the row.");
+
+    private:
+        std::tuple<std::vector<Ts>...> m_columns;
+        std::array<std::vector<std::uint8_t>, sizeof...(Ts)> m_validity;
+        std::size_t m_rowCount;
+
+        template <std::size_t... Is>
+        void Append(sqlite3_stmt* const pStatement, std::index_sequence<Is...>);
+
+        template <std::size_t I>
+        void AppendColumn(sqlite3_stmt* const pStatement);
+
+    public:
+        ColumnBuffers(void);
+
+        ColumnBuffers(const ColumnBuffers&) = default;
+        ColumnBuffers(ColumnBuffers&&) noexcept = default;
+        virtual ~ColumnBuffers(void) = default;
+
+        ColumnBuffers& operator= (const ColumnBuffers&) = default;
+        ColumnBuffers& operator= (ColumnBuffers&&) noexcept = default;
+
+        /**
+         * Returns the number of stored rows.
+         *
+         * @returns An integer.
+         */
+        std::size_t GetRowCount(void) const;
+
+        /**
+         * Returns the values of a column.
+         *
+         * @tparam I Column index.
+         * @returns A vector of GetRowCount() values.
+         */
+        template <std::size_t I>
+        const std::vector<std::tuple_element_t<I, std::tuple<Ts...>>>& GetColumn(void) const;
+
+        /**
+         * Returns the validity bitmap of a column.
+         *
+         * @tparam I Column index.
+         * @returns A vector of (GetRowCount() + 7) / 8 bytes.
+         */
+        template <std::size_t I>
+        const std::vector<std::uint8_t>& GetValidity(void) const;
+
+        /**
+         * Checks whether a value is NULL.
+         *
+         * @tparam I Column index.
+         * @param row Row index.
+         * @returns true if the value is NULL; otherwise, false.
+         */
+        template <std::size_t I>
+        bool IsNull(const std::size_t row) const;
+
+        /**
+         * Removes all rows. Allocated capacity is kept.
+         */
+        void Clear(void);
+
+        /**
+         * Reserves capacity for the given number of rows.
+         *
+         * @param rows Number of rows.
+         */
+        void Reserve(const std::size_t rows);
+
+        friend class Statement;
+
+    };
+
+    template <typename... Ts>
+    inline ColumnBuffers<Ts...>::ColumnBuffers() : m_columns(), m_validity(), m_rowCount(0) { }
+
+    template <typename... Ts>
+    inline std::size_t ColumnBuffers<Ts...>::GetRowCount() const {
+        return this->m_rowCount;
+    }
+
+    template <typename... Ts>
+    template <std::size_t I>
+    inline const std::vector<std::tuple_element_t<I, std::tuple<Ts...>>>& ColumnBuffers<Ts...>::GetColumn() const {
+        return std::get<I>(this->m_columns);
+    }
+
+    template <typename... Ts>
+    template <std::size_t I>
+    inline const std::vector<std::uint8_t>& ColumnBuffers<Ts...>::GetValidity() const {
+        return this->m_validity[I];
+    }
+
+    template <typename... Ts>
+    template <std::size_t I>
+    inline bool ColumnBuffers<Ts...>::IsNull(const std::size_t row) const {
+        return ((this->m_validity[I][row / 8] & (1u << (row % 8))) == 0);
+    }
+
+    template <typename... Ts>
+    inline void ColumnBuffers<Ts...>::Clear() {
+        std::apply([] (auto&... columns) { (columns.clear(), ...); }, this->m_columns);
+        for (std::vector<std::uint8_t>& validity : this->m_validity) validity.clear();
+        this->m_rowCount = 0;
+    }
+
+    template <typename... Ts>
+    inline void ColumnBuffers<Ts...>::Reserve(const std::size_t rows) {
+        std::apply([rows] (auto&... columns) { (columns.reserve(rows), ...); }, this->m_columns);
+        for (std::vector<std::uint8_t>& validity : this->m_validity) validity.reserve((rows + 7) / 8);
+    }
+
+    template <typename... Ts>
+    template <std::size_t... Is>
+    inline void ColumnBuffers<Ts...>::Append(sqlite3_stmt* const pStatement, std::index_sequence<Is...>) {
+        (this->AppendColumn<Is>(pStatement), ...);
+        ++this->m_rowCount;
+    }
+
+    template <typename... Ts>
+    template <std::size_t I>
+    inline void ColumnBuffers<Ts...>::AppendColumn(sqlite3_stmt* const pStatement) {
+
+        using T = std::tuple_element_t<I, std::tuple<Ts...>>;
+
+        std::vector<std::uint8_t>& validity = this->m_validity[I];
+        if ((this->m_rowCount % 8) == 0) validity.push_back(0);
+
+        T& value = std::get<I>(this->m_columns).emplace_back();
+        if (sqlite3_column_type(pStatement, static_cast<std::int32_t>(I)) != SQLITE_NULL) {
+            DataBinding<T>::Column(pStatement, static_cast<std::int32_t>(I), value);
+            validity.back() |= static_cast<std::uint8_t>(1u << (this->m_rowCount % 8));
+        }
+
+    }
+
+    template <typename... Ts>
+    inline std::size_t Statement::FetchBatch(const std::size_t count, ColumnBuffers<Ts...>& buffers) {
+
+        // Larger batches grow as rows arrive instead of reserving 'count' rows up front.
+        constexpr std::size_t MaxReservedRows = 4096;
+
+        buffers.Clear();
+
+        // Stepping a finished statement would reset it and restart the query.
+        if (this->m_done) return 0;
+
+        buffers.Reserve(std::min(count, MaxReservedRows));
+
+        while ((buffers.GetRowCount() < count) && this->Fetch())
+            buffers.Append(this->m_pStatement, std::index_sequence_for<Ts...> { });
+
+        return buffers.GetRowCount();
+    }
+
+}
+
+#endif // _VSQLITE_COLUMNBUFFERS_H_
\ No newline at end of file
@@ -0,0 +1,385 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#ifndef _VSQLITE_CONNECTIONPOOL_H_
+#define _VSQLITE_CONNECTIONPOOL_H_
+
+#include <Vsqlite/SQLite.h>
+#include <Vsqlite/Database.h>
+#include <Vsqlite/Statement.h>
+#include <Vsqlite/StatementCache.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <optional>
+#include <mutex>
+#include <condition_variable>
+#include <stdexcept>
+#include <cstdint>
+#include <cstddef>
+
+namespace Vsqlite {
+
+    class ConnectionPool;
+
+    /**
+     * ConnectionPool settings.
+     */
+    struct ConnectionPoolOptions {
+
+        /**
+         * Number of read-only connections.
+         */
+        std::size_t Readers = 4;
+
+        /**
+         * Busy timeout of every connection, in milliseconds.
+         */
+        std::int32_t BusyTimeout = 5000;
+
+        /**
+         * Statement cache capacity of every connection.
+         */
+        std::size_t StatementCacheCapacity = StatementCache::DefaultCapacity;
+
+    };
+
+    /**
+     * Represents a connection leased from a ConnectionPool.
+     *
+     * The connection is returned to the pool when the lease is destroyed.
+     * A lease can be moved to and released on another thread, but must not outlive the pool.
+     */
+    class ConnectionLease {
+
+    private:
+        ConnectionPool* m_pPool;
+        Database* m_pDatabase;
+        bool m_isWriter;
+
+        ConnectionLease(ConnectionPool* const pPool, Database* const pDatabase, const bool isWriter);
+
+        void Release(void) noexcept;
+
+    public:
+        ConnectionLease(const ConnectionLease&) = delete;
+        ConnectionLease(ConnectionLease&& lease) noexcept;
+        virtual ~ConnectionLease(void);
+
+        ConnectionLease& operator= (const ConnectionLease&) = delete;
+        ConnectionLease& operator= (ConnectionLease&& lease) noexcept;
+
+        /**
+         * Returns the leased connection.
+         *
+         * @returns A Database.
+         */
+        Database& GetDatabase(void) const;
+
+        Database& operator* (void) const;
+        Database* operator-> (void) const;
+
+        /**
+         * Checks whether the leased connection is the write connection.
+         *
+         * @returns true if the connection is the write connection; otherwise, false.
+         */
+        bool IsWriter(void) const;
+
+        friend class ConnectionPool;
+
+    };
+
+    /**
+     * Represents a pool of connections to a WAL database:
+     * one write connection and a number of read-only connections.
+     *
+     * Each connection is used by one thread at a time and keeps its own statement cache.
+     * Readers run concurrently; writers are serialized.
+     *
+     * Callers waiting for readers are served in arrival order: idle readers are reserved for
+     * the caller that has waited longest, so that callers leasing single readers cannot starve
+     * a caller that needs several. A thread must therefore not wait for readers while it holds
+     * reader leases. Its request may need the readers it holds, e.g. AcquireReaders(GetReaderCount())
+     * while holding one, or queue behind a request that does; either way it waits forever.
+     */
+    class ConnectionPool {
+
+    private:
+        Database m_writer;
+        std::vector<Database> m_readers;
+        std::vector<Database*> m_idleReaders;
+        std::mutex m_readerMutex;
+        std::condition_variable m_readerAvailable;
+        std::uint64_t m_nextTicket;
+        std::uint64_t m_servingTicket;
+        std::mutex m_writerMutex;
+        std::condition_variable m_writerAvailable;
+        bool m_writerLeased;
+
+        void ReturnReader(Database* const pDatabase) noexcept;
+        void ReturnWriter(void) noexcept;
+        void WaitForReaders(std::unique_lock<std::mutex>& lock, const std::size_t count);
+        void ServeNextWaiter(std::unique_lock<std::mutex>& lock) noexcept;
+
+    public:
+
+        /**
+         * Constructs a new ConnectionPool object.
+         * The database is created if it does not exist and switched to WAL mode.
+         *
+         * @param filename Database filename.
+         * @param options Pool settings.
+         * @exception std::invalid_argument - The 'filename' parameter is an empty string,
+         * options.Readers is zero, or the database does not support WAL mode.
+         * @exception SqliteException
+         */
+        ConnectionPool(const std::string_view filename, const ConnectionPoolOptions& options = { });
+
+        ConnectionPool(const ConnectionPool&) = delete;
+        ConnectionPool(ConnectionPool&&) = delete;
+        virtual ~ConnectionPool(void) = default;
+
+        ConnectionPool& operator= (const ConnectionPool&) = delete;
+        ConnectionPool& operator= (ConnectionPool&&) = delete;
+
+        /**
+         * Leases a read-only connection, waiting until one is available and
+         * every caller that started waiting earlier has been served.
+         *
+         * @returns A ConnectionLease.
+         */
+        [[nodiscard]] ConnectionLease AcquireReader(void);
+
+        /**
+         * Leases a read-only connection if one is available and no caller is waiting for readers.
+         *
+         * @returns A ConnectionLease, or std::nullopt if all readers are leased or reserved for a waiting caller.
+         */
+        [[nodiscard]] std::optional<ConnectionLease> TryAcquireReader(void);
+
+        /**
+         * Leases several read-only connections at once, waiting until that many are available and
+         * every caller that started waiting earlier has been served. No connection is held while
+         * waiting, so concurrent callers that hold no leases cannot deadlock each other.
+         *
+         * @param count Number of connections.
+         * @returns A vector of ConnectionLease objects.
+         * @exception std::invalid_argument - The 'count' parameter is zero or greater than the number of readers.
+         */
+        [[nodiscard]] std::vector<ConnectionLease> AcquireReaders(const std::size_t count);
+
+        /**
+         * Leases the write connection, waiting until it is available.
+         *
+         * @returns A ConnectionLease.
+         */
+        [[nodiscard]] ConnectionLease AcquireWriter(void);
+
+        /**
+         * Returns the number of read-only connections.
+         *
+         * @returns An integer.
+         */
+        std::size_t GetReaderCount(void) const;
+
+        friend class ConnectionLease;
+
+    };
+
+    inline ConnectionLease::ConnectionLease(ConnectionPool* const pPool, Database* const pDatabase, const bool isWriter)
+        : m_pPool(pPool), m_pDatabase(pDatabase), m_isWriter(isWriter) { }
+
+    inline ConnectionLease::ConnectionLease(ConnectionLease&& lease) noexcept {
+        this->m_pPool = nullptr;
+        this->operator= (std::move(lease));
+    }
+
+    inline ConnectionLease::~ConnectionLease() {
+        this->Release();
+    }
+
+    inline ConnectionLease& ConnectionLease::operator= (ConnectionLease&& lease) noexcept {
+
+        if (this != &lease) {
+
+            this->Release();
+
+            this->m_pPool = lease.m_pPool;
+            this->m_pDatabase = lease.m_pDatabase;
+            this->m_isWriter = lease.m_isWriter;
+            lease.m_pPool = nullptr;
+            lease.m_pDatabase = nullptr;
+
+        }
+
+        return static_cast<ConnectionLease&>(*this);
+    }
+
+    inline void ConnectionLease::Release() noexcept {
+
+        if (this->m_pPool) {
+            if (this->m_isWriter) this->m_pPool->ReturnWriter();
+            else this->m_pPool->ReturnReader(this->m_pDatabase);
+            this->m_pPool = nullptr;
+            this->m_pDatabase = nullptr;
+        }
+
+    }
+
+    inline Database& ConnectionLease::GetDatabase() const {
+        return *this->m_pDatabase;
+    }
+
+    inline Database& ConnectionLease::operator* () const {
+        return *this->m_pDatabase;
+    }
+
+    inline Database* ConnectionLease::operator-> () const {
+        return this->m_pDatabase;
+    }
+
+    inline bool ConnectionLease::IsWriter() const {
+        return this->m_isWriter;
+    }
+
+    inline ConnectionPool::ConnectionPool(const std::string_view filename, const ConnectionPoolOptions& options)
+        : m_writer(filename, (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_NOMUTEX)),
+        m_nextTicket(0), m_servingTicket(0), m_writerLeased(false) {
+
+        if (options.Readers == 0)
+            throw std::invalid_argument("'options': Readers must be greater than zero.");
+
+        // Switching to WAL takes a lock, so the busy handler must already be installed.
+        sqlite3_busy_timeout(this->m_writer.GetDatabaseHandle(), options.BusyTimeout);
+
+        std::string journalMode = { };
+        this->m_writer.Execute("PRAGMA journal_mode=WAL;").Fetch(journalMode);
+        if (journalMode != "wal")
+            throw std::invalid_argument("'filename': The database does not support WAL mode.");
+
+        this->m_writer.GetStatementCache().SetCapacity(options.StatementCacheCapacity);
+
+        this->m_readers.reserve(options.Readers);
+        this->m_idleReaders.reserve(options.Readers);
+
+        for (std::size_t i = 0; i < options.Readers; ++i) {
+            Database& reader = this->m_readers.emplace_back(filename, (SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX));
+            sqlite3_busy_timeout(reader.GetDatabaseHandle(), options.BusyTimeout);
+            reader.GetStatementCache().SetCapacity(options.StatementCacheCapacity);
+            this->m_idleReaders.push_back(&reader);
+        }
+
+    }
+
+    inline void ConnectionPool::ReturnReader(Database* const pDatabase) noexcept {
+
+        {
+            const std::lock_guard<std::mutex> lock(this->m_readerMutex);
+            this->m_idleReaders.push_back(pDatabase);
+        }
+
+        // Waiters may need different numbers of readers, so each one rechecks.
+        this->m_readerAvailable.notify_all();
+
+    }
+
+    inline void ConnectionPool::ReturnWriter() noexcept {
+
+        {
+            const std::lock_guard<std::mutex> lock(this->m_writerMutex);
+            this->m_writerLeased = false;
+        }
+
+        this->m_writerAvailable.notify_one();
+
+    }
+
+    inline void ConnectionPool::WaitForReaders(std::unique_lock<std::mutex>& lock, const std::size_t count) {
+
+        const std::uint64_t ticket = this->m_nextTicket++;
+
+        this->m_readerAvailable.wait(lock, [this, ticket, count] () {
+            return ((this->m_servingTicket == ticket) && (this->m_idleReaders.size() >= count));
+        });
+
+        ++this->m_servingTicket;
+
+    }
+
+    inline void ConnectionPool::ServeNextWaiter(std::unique_lock<std::mutex>& lock) noexcept {
+
+        // The next waiter may be satisfied by the readers that are still idle.
+        const bool wake = ((this->m_nextTicket != this->m_servingTicket) && !this->m_idleReaders.empty());
+        lock.unlock();
+
+        if (wake) this->m_readerAvailable.notify_all();
+
+    }
+
+    inline ConnectionLease ConnectionPool::AcquireReader() {
+
+        std::unique_lock<std::mutex> lock(this->m_readerMutex);
+        this->WaitForReaders(lock, 1);
+
+        Database* const pDatabase = this->m_idleReaders.back();
+        this->m_idleReaders.pop_back();
+
+        this->ServeNextWaiter(lock);
+
+        return ConnectionLease(this, pDatabase, false);
+    }
+
+    inline std::optional<ConnectionLease> ConnectionPool::TryAcquireReader() {
+
+        const std::lock_guard<std::mutex> lock(this->m_readerMutex);
+        if (this->m_idleReaders.empty() || (this->m_nextTicket != this->m_servingTicket)) return std::nullopt;
+
+        Database* const pDatabase = this->m_idleReaders.back();
+        this->m_idleReaders.pop_back();
+
+        return ConnectionLease(this, pDatabase, false);
+    }
+
+    inline std::vector<ConnectionLease> ConnectionPool::AcquireReaders(const std::size_t count) {
+
+        if ((count == 0) || (count > this->m_readers.size()))
+            throw std::invalid_argument("'count': Must be between one and the number of readers.");
+
+        std::vector<ConnectionLease> leases = { };
+        leases.reserve(count);
+
+        std::unique_lock<std::mutex> lock(this->m_readerMutex);
+        this->WaitForReaders(lock, count);
+
+        for (std::size_t i = 0; i < count; ++i) {
+            leases.push_back(ConnectionLease(this, this->m_idleReaders.back(), false));
+            this->m_idleReaders.pop_back();
+        }
+
+        this->ServeNextWaiter(lock);
+
+        return leases;
+    }
+
+    inline ConnectionLease ConnectionPool::AcquireWriter() {
+
+        // A flag rather than a held mutex, so that the lease can be released on any thread.
+        std::unique_lock<std::mutex> lock(this->m_writerMutex);
+        this->m_writerAvailable.wait(lock, [this] () { return !this->m_writerLeased; });
+        this->m_writerLeased = true;
+
+        return ConnectionLease(this, &this->m_writer, true);
+    }
+
+    inline std::size_t ConnectionPool::GetReaderCount() const {
+        return this->m_readers.size();
+    }
+
+}
+
+#endif // _VSQLITE_CONNECTIONPOOL_H_
\ No newline at end of file
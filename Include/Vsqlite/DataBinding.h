@@ -13,6 +13,8 @@
 #include <cstddef>
 #include <string>
 #include <string_view>
+#include <span>
+#include <vector>
 #include <type_traits>
 #include <typeinfo>
 #include <concepts>
@@ -36,6 +38,49 @@ namespace Vsqlite {
 
     };
 
+    /**
+     * Wraps a caller-owned value that is bound without being copied by SQLite.
+     * 
+     * The value must remain valid and unchanged until the statement is reset,
+     * rebound or finalized.
+     */
+    template <typename T>
+    class Borrowed {
+
+    private:
+        const T* m_pValue;
+
+    public:
+
+        /**
+         * Constructs a new Borrowed object.
+         * 
+         * @param value A caller-owned value.
+         */
+        explicit Borrowed(const T& value) : m_pValue(&value) { }
+
+        Borrowed(const T&&) = delete;
+
+        /**
+         * Returns the borrowed value.
+         * 
+         * @returns A reference to the borrowed value.
+         */
+        const T& Get(void) const {
+            return *this->m_pValue;
+        }
+
+    };
+
+    /**
+     * Represents a BLOB of the given size filled with zeros.
+     * 
+     * Binding a ZeroBlob reserves space that can later be filled incrementally using a BlobStream.
+     */
+    struct ZeroBlob {
+        std::uint64_t Size;
+    };
+
 }
 
 #ifndef VSQLITE_NO_DEFAULT_DATABINDING_SPECIALIZATIONS
@@ -61,20 +106,28 @@ namespace Vsqlite {
 
     };
 
-    template <std::size_t L>
-    struct DataBinding<char[L]> {
+    template <>
+    struct DataBinding<std::string_view> {
 
-        static inline std::int32_t Bind(sqlite3_stmt* const pStatement, const std::int32_t index, const char (&arg)[L]) {
-            return sqlite3_bind_text(pStatement, index, arg, static_cast<std::int32_t>(L - 1), SQLITE_TRANSIENT);
+        static inline std::int32_t Bind(sqlite3_stmt* const pStatement, const std::int32_t index, const std::string_view& arg) {
+            return sqlite3_bind_text64(pStatement, index, (arg.data() ? arg.data() : ""), arg.length(), SQLITE_TRANSIENT, SQLITE_UTF8);
+        }
+
+        /* the view points into the statement's row buffer and is valid until the next Step or Reset. */
+        static inline void Column(sqlite3_stmt* const pStatement, const std::int32_t column, std::string_view& arg) {
+            const unsigned char* pText = sqlite3_column_text(pStatement, column);
+            const std::int32_t len = sqlite3_column_bytes(pStatement, column);
+            arg = { reinterpret_cast<const char*>(pText), static_cast<std::size_t>(len) };
         }
 
     };
 
-    template <>
-    struct DataBinding<std::string_view> {
+    template <std::size_t L>
+    struct DataBinding<char[L]> {
 
-        static inline std::int32_t Bind(sqlite3_stmt* const pStatement, const std::int32_t index, const std::string_view& arg) {
-            return DataBinding<const char*>::Bind(pStatement, index, arg.data());
+        static inline std::int32_t Bind(sqlite3_stmt* const pStatement, const std::int32_t index, const char (&arg)[L]) {
+            const std::size_t len = ((arg[L - 1] == '\0') ? (L - 1) : L);
+            return DataBinding<std::string_view>::Bind(pStatement, index, { arg, len });
         }
 
     };
@@ -83,7 +136,7 @@ namespace Vsqlite {
     struct DataBinding<std::string> {
 
         static inline std::int32_t Bind(sqlite3_stmt* const pStatement, const std::int32_t index, const std::string& arg) {
-            return DataBinding<const char*>::Bind(pStatement, index, arg.c_str());
+            return DataBinding<std::string_view>::Bind(pStatement, index, arg);
         }
 
         static inline void Column(sqlite3_stmt* const pStatement, const std::int32_t column, std::string& arg) {
@@ -94,6 +147,85 @@ namespace Vsqlite {
 
     };
 
+    template <typename T>
+    requires std::convertible_to<const T&, std::string_view>
+    struct DataBinding<Borrowed<T>> {
+
+        static inline std::int32_t Bind(sqlite3_stmt* const pStatement, const std::int32_t index, const Borrowed<T>& arg) {
+            
+            if constexpr (std::is_pointer_v<T>)
+                if (arg.Get() == nullptr) return DataBinding<std::nullptr_t>::Bind(pStatement, index, nullptr);
+
+            std::string_view str = { };
+
+            // Arrays use their extent, like DataBinding<char[L]>, instead of strlen.
+            if constexpr (std::is_array_v<T>) {
+                constexpr std::size_t L = std::extent_v<T>;
+                const T& chars = arg.Get();
+                str = { chars, ((chars[L - 1] == '\0') ? (L - 1) : L) };
+            }
+            else str = arg.Get();
+
+            return sqlite3_bind_text64(pStatement, index, (str.data() ? str.data() : ""), str.length(), SQLITE_STATIC, SQLITE_UTF8);
+        }
+
+    };
+
+    /* binary types */
+
+    template <>
+    struct DataBinding<std::span<const std::byte>> {
+
+        static inline std::int32_t Bind(sqlite3_stmt* const pStatement, const std::int32_t index, const std::span<const std::byte>& arg) {
+            if (arg.empty()) return sqlite3_bind_zeroblob(pStatement, index, 0);
+            return sqlite3_bind_blob64(pStatement, index, arg.data(), arg.size(), SQLITE_TRANSIENT);
+        }
+
+        /* the span points into the statement's row buffer and is valid until the next Step or Reset. */
+        static inline void Column(sqlite3_stmt* const pStatement, const std::int32_t column, std::span<const std::byte>& arg) {
+            const void* pBlob = sqlite3_column_blob(pStatement, column);
+            const std::int32_t len = sqlite3_column_bytes(pStatement, column);
+            arg = { static_cast<const std::byte*>(pBlob), static_cast<std::size_t>(len) };
+        }
+
+    };
+
+    template <>
+    struct DataBinding<std::vector<std::byte>> {
+
+        static inline std::int32_t Bind(sqlite3_stmt* const pStatement, const std::int32_t index, const std::vector<std::byte>& arg) {
+            return DataBinding<std::span<const std::byte>>::Bind(pStatement, index, arg);
+        }
+
+        static inline void Column(sqlite3_stmt* const pStatement, const std::int32_t column, std::vector<std::byte>& arg) {
+            std::span<const std::byte> blob = { };
+            DataBinding<std::span<const std::byte>>::Column(pStatement, column, blob);
+            arg.assign(blob.begin(), blob.end());
+        }
+
+    };
+
+    template <typename T>
+    requires std::convertible_to<const T&, std::span<const std::byte>>
+    struct DataBinding<Borrowed<T>> {
+
+        static inline std::int32_t Bind(sqlite3_stmt* const pStatement, const std::int32_t index, const Borrowed<T>& arg) {
+            const std::span<const std::byte> blob = arg.Get();
+            if (blob.empty()) return sqlite3_bind_zeroblob(pStatement, index, 0);
+            return sqlite3_bind_blob64(pStatement, index, blob.data(), blob.size(), SQLITE_STATIC);
+        }
+
+    };
+
+    template <>
+    struct DataBinding<ZeroBlob> {
+
+        static inline std::int32_t Bind(sqlite3_stmt* const pStatement, const std::int32_t index, const ZeroBlob& arg) {
+            return sqlite3_bind_zeroblob64(pStatement, index, arg.Size);
+        }
+
+    };
+
     /* integer types */
 
     template <typename T>
@@ -200,7 +332,7 @@ namespace Vsqlite {
     template <>
     struct DataBinding<std::nullopt_t> {
 
-        static inline std::int32_t Bind(sqlite3_stmt* const pStatement, const std::int32_t index, const std::nullopt_t& arg) {
+        static inline std::int32_t Bind(sqlite3_stmt* const pStatement, const std::int32_t index, const std::nullopt_t&) {
             return DataBinding<std::nullptr_t>::Bind(pStatement, index, nullptr);
         }
 
@@ -9,13 +9,79 @@
 
 #include <Vsqlite/SQLite.h>
 #include <Vsqlite/SqliteException.h>
+#include <Vsqlite/DatabaseOptions.h>
 
+#include <string>
 #include <string_view>
 #include <optional>
+#include <memory>
+#include <ranges>
+#include <vector>
+#include <span>
+#include <algorithm>
 
 namespace Vsqlite {
 
     class Statement;
+    class StatementCache;
+    class CachedStatement;
+    class QueryProfiler;
+    struct QueryProfilerOptions;
+    struct BulkInsertOptions;
+    struct BulkInsertStatistics;
+    struct ScriptOptions;
+    struct ScriptResult;
+    class SerializedDatabase;
+    class DatabaseImage;
+    struct ImageOptions;
+    struct VirtualTableOptions;
+
+    template <typename... Ts>
+    struct RowValue;
+
+    class Executor;
+
+    template <typename T>
+    class AsyncOperation;
+
+    /**
+     * Memory usage and page cache counters of a database connection.
+     * More info: https://www.sqlite.org/c3ref/c_dbstatus_options.html
+     */
+    struct MemoryStatistics {
+
+        /**
+         * Bytes of heap used by the page cache, and this connection's share of shared caches.
+         */
+        std::int64_t CacheUsed;
+        std::int64_t CacheUsedShared;
+
+        /**
+         * Page cache hits, misses, pages written and pages spilled in mid-transaction.
+         */
+        std::int64_t CacheHits;
+        std::int64_t CacheMisses;
+        std::int64_t CacheWrites;
+        std::int64_t CacheSpills;
+
+        /**
+         * Lookaside slots in use, the highest number of slots ever in use, allocations
+         * served from lookaside and allocations that missed it because the requested size
+         * was too large or because all slots were in use.
+         */
+        std::int64_t LookasideUsed;
+        std::int64_t LookasideHighwater;
+        std::int64_t LookasideHits;
+        std::int64_t LookasideMissSize;
+        std::int64_t LookasideMissFull;
+
+        /**
+         * Bytes of heap used by schemas and by prepared statements.
+         */
+        std::int64_t SchemaUsed;
+        std::int64_t StatementUsed;
+
+    };
 
     /**
      * Represents an SQLite database.
@@ -24,6 +90,11 @@ namespace Vsqlite {
 
     private:
         sqlite3* m_pDatabase;
+        std::unique_ptr<StatementCache> m_pStatementCache;
+        // Shared, so that the deleter is bound where the profiler is created
+        // and this header does not need the complete QueryProfiler type.
+        std::shared_ptr<QueryProfiler> m_pProfiler;
+        const DatabaseImage* m_pImage;
 
     public:
 
@@ -39,6 +110,47 @@ namespace Vsqlite {
          */
         Database(const std::optional<std::string_view> filename, const std::int32_t flags);
 
+        /**
+         * Constructs a new Database object and applies connection settings.
+         * If a setting cannot be applied, the database is closed and an exception is thrown.
+         * 
+         * @param filename Database filename. If this parameter is set to std::nullopt,
+         * an in-memory database is created.
+         * @param flags Flags for file open operations.
+         * The full list of flags can be found at: https://www.sqlite.org/c3ref/c_open_autoproxy.html
+         * @param options Connection settings, e.g. DatabaseOptions::WriteHeavy().
+         * @exception std::invalid_argument - The 'filename' parameter is an empty string,
+         * or the database does not support the requested journal mode.
+         * @exception SqliteException
+         */
+        Database(const std::optional<std::string_view> filename, const std::int32_t flags, const DatabaseOptions& options);
+
+        /**
+         * Opens a read-only database from a file that is mapped or read into memory as a whole,
+         * so that queries never wait for page reads once the image is resident.
+         * The image is used in place and is owned by the connection, which frees it once it is
+         * closed, i.e. once the database and all of its statements are destroyed.
+         * Defined in <Vsqlite/DatabaseImage.h>.
+         * 
+         * @param filename Path of the database file.
+         * @param options How the file is loaded and warmed up.
+         * @returns The database.
+         * @exception std::invalid_argument - The 'filename' parameter is an empty string.
+         * @exception SqliteException
+         */
+        static Database OpenImage(const std::string_view filename, const ImageOptions& options);
+
+        /**
+         * Opens a read-only database from a memory-mapped file, without warmup.
+         * Defined in <Vsqlite/DatabaseImage.h>.
+         * 
+         * @param filename Path of the database file.
+         * @returns The database.
+         * @exception std::invalid_argument - The 'filename' parameter is an empty string.
+         * @exception SqliteException
+         */
+        static Database OpenImage(const std::string_view filename);
+
         Database(const Database&) = delete;
         Database(Database&& database) noexcept;
         virtual ~Database(void);
@@ -53,6 +165,146 @@ namespace Vsqlite {
          */
         sqlite3* GetDatabaseHandle(void) const;
 
+        /**
+         * Applies connection settings. Settings that are not set are left unchanged.
+         * 
+         * @param options Connection settings.
+         * @exception std::invalid_argument - The database does not support the requested journal mode.
+         * @exception SqliteException
+         */
+        void Configure(const DatabaseOptions& options);
+
+        /**
+         * Reads the current connection settings.
+         * Settings that the SQLite library does not report (e.g. mmap_size if memory mapping
+         * is disabled at compile time) are std::nullopt.
+         * 
+         * @returns A DatabaseOptions.
+         * @exception SqliteException
+         */
+        DatabaseOptions GetSettings(void) const;
+
+        /**
+         * Sets the maximum number of bytes of the database file accessed through memory-mapped I/O.
+         * The value is capped by the SQLITE_MAX_MMAP_SIZE compile-time limit.
+         * 
+         * @param bytes Number of bytes. Zero disables memory-mapped I/O.
+         * @returns The effective mmap size.
+         * @exception std::invalid_argument - The 'bytes' parameter is negative.
+         * @exception SqliteException
+         */
+        std::int64_t SetMmapSize(const std::int64_t bytes);
+
+        /**
+         * Returns the maximum number of bytes of the database file accessed through memory-mapped I/O.
+         * 
+         * @returns The mmap size, or zero if memory-mapped I/O is disabled or unsupported.
+         * @exception SqliteException
+         */
+        std::int64_t GetMmapSize(void) const;
+
+        /**
+         * Configures the lookaside memory allocator of this connection.
+         * Must be called while the connection has no lookaside memory in use.
+         * Has no effect if SQLite is compiled with SQLITE_OMIT_LOOKASIDE.
+         * 
+         * @param slotSize Size of each slot in bytes. Zero disables lookaside.
+         * @param slotCount Number of slots.
+         * @exception std::invalid_argument - The 'slotSize' or 'slotCount' parameter is negative.
+         * @exception SqliteException - Lookaside memory is in use (SQLITE_BUSY).
+         */
+        void ConfigureLookaside(const std::int32_t slotSize, const std::int32_t slotCount);
+
+        /**
+         * Returns a snapshot of the connection's memory usage and page cache counters.
+         * 
+         * @param reset Reset the cache hit/miss/write/spill counters and lookaside highwater marks.
+         * @returns A MemoryStatistics.
+         * @exception SqliteException
+         */
+        MemoryStatistics GetMemoryStatistics(const bool reset = false) const;
+
+        /**
+         * Frees as much memory as possible from the connection's page cache.
+         * 
+         * @exception SqliteException
+         */
+        void ReleaseMemory(void);
+
+        /**
+         * Sets the process-wide soft heap limit. When SQLite's memory usage exceeds it,
+         * SQLite tries to free page cache memory before allocating more.
+         * 
+         * @param bytes Limit in bytes. Zero removes the limit.
+         * @returns The previous limit.
+         * @exception std::invalid_argument - The 'bytes' parameter is negative.
+         */
+        static std::int64_t SetSoftHeapLimit(const std::int64_t bytes);
+
+        /**
+         * Returns the process-wide soft heap limit.
+         * 
+         * @returns The limit in bytes, or zero if there is no limit.
+         */
+        static std::int64_t GetSoftHeapLimit(void);
+
+        /**
+         * Sets the process-wide hard heap limit. Allocations that would exceed it fail with SQLITE_NOMEM.
+         * 
+         * @param bytes Limit in bytes. Zero removes the limit.
+         * @returns The previous limit.
+         * @exception std::invalid_argument - The 'bytes' parameter is negative.
+         */
+        static std::int64_t SetHardHeapLimit(const std::int64_t bytes);
+
+        /**
+         * Serializes a schema into the bytes of an equivalent database file.
+         * Defined in <Vsqlite/Backup.h>.
+         * 
+         * @param schema Name of the schema.
+         * @returns A copy of the database image.
+         * @exception std::invalid_argument - The 'schema' parameter is an empty string or does not name a schema.
+         * @exception SqliteException
+         */
+        SerializedDatabase Serialize(const std::string_view schema = "main") const;
+
+        /**
+         * Returns the database image of a schema without copying it. This is only possible
+         * for in-memory databases whose contents are held contiguously, such as those loaded
+         * with Deserialize. The image is only valid until the schema is next modified or closed.
+         * Defined in <Vsqlite/Backup.h>.
+         * 
+         * @param schema Name of the schema.
+         * @returns The database image, or an empty span if it cannot be returned without copying.
+         * @exception std::invalid_argument - The 'schema' parameter is an empty string.
+         */
+        std::span<const std::byte> SerializeNoCopy(const std::string_view schema = "main") const;
+
+        /**
+         * Replaces the contents of a schema with a database image. The schema becomes an
+         * in-memory database that owns the image.
+         * Defined in <Vsqlite/Backup.h>.
+         * 
+         * @param image A database image, as returned by Serialize.
+         * @param schema Name of the schema.
+         * @param readOnly Open the image read-only. Otherwise, it grows as needed.
+         * @exception std::invalid_argument - The 'schema' parameter is an empty string.
+         * @exception SqliteException
+         */
+        void Deserialize(SerializedDatabase&& image, const std::string_view schema = "main", const bool readOnly = false);
+
+        /**
+         * Replaces the contents of a schema with a copy of a database image.
+         * Defined in <Vsqlite/Backup.h>.
+         * 
+         * @param image The bytes of a database file.
+         * @param schema Name of the schema.
+         * @param readOnly Open the image read-only. Otherwise, it grows as needed.
+         * @exception std::invalid_argument - The 'schema' parameter is an empty string.
+         * @exception SqliteException
+         */
+        void Deserialize(const std::span<const std::byte> image, const std::string_view schema = "main", const bool readOnly = false);
+
         /**
          * Creates a prepared statement.
          * 
@@ -66,6 +318,7 @@ namespace Vsqlite {
 
         /**
          * Executes an SQL statement.
+         * Only the first statement is executed; use ExecuteScript to run several.
          * 
          * @param sql An SQL statement.
          * @returns A Statement.
@@ -74,9 +327,313 @@ namespace Vsqlite {
          */
         Statement Execute(const std::string_view sql);
 
+        /**
+         * Executes every statement of an SQL script, in order.
+         * Each statement is prepared directly from the script text and stepped to completion.
+         * Defined in <Vsqlite/Script.h>.
+         * 
+         * @param sql One or more SQL statements.
+         * @param options Transaction and timing options.
+         * @returns The number of statements and changes, and optionally per-statement timings.
+         * @exception std::invalid_argument - The 'sql' parameter is an empty string.
+         * @exception SqliteException - A statement failed. If the script is atomic, it has been rolled back.
+         */
+        ScriptResult ExecuteScript(const std::string_view sql, const ScriptOptions& options);
+
+        /**
+         * Executes every statement of an SQL script, in order, in a single immediate transaction.
+         * Defined in <Vsqlite/Script.h>.
+         * 
+         * @param sql One or more SQL statements.
+         * @returns The number of statements and changes.
+         * @exception std::invalid_argument - The 'sql' parameter is an empty string.
+         * @exception SqliteException - A statement failed. The script has been rolled back.
+         */
+        ScriptResult ExecuteScript(const std::string_view sql);
+
+        /**
+         * Leases a prepared statement from the database's statement cache.
+         * The statement is reset, has no bound parameters, and is returned to the cache
+         * when the lease is destroyed.
+         * 
+         * @param sql An SQL statement.
+         * @returns A CachedStatement.
+         * @exception std::invalid_argument - The 'sql' parameter is an empty string.
+         * @exception SqliteException
+         */
+        [[nodiscard]] CachedStatement Cached(const std::string_view sql);
+
+        /**
+         * Returns the database's statement cache.
+         * 
+         * @returns A StatementCache.
+         */
+        StatementCache& GetStatementCache(void);
+
+        /**
+         * Returns the image the database was opened from.
+         * Defined in <Vsqlite/DatabaseImage.h>.
+         * 
+         * @returns A pointer to the DatabaseImage, or nullptr if the database was not opened with OpenImage.
+         */
+        const DatabaseImage* GetImage(void) const;
+
+        /**
+         * Starts collecting per-statement measurements on this connection.
+         * Measurements collected by a previously enabled profiler are discarded.
+         * Defined in <Vsqlite/QueryProfiler.h>.
+         *
+         * @param options Profiler settings.
+         * @returns The profiler.
+         * @exception SqliteException
+         */
+        QueryProfiler& EnableProfiling(const QueryProfilerOptions& options);
+
+        /**
+         * Starts collecting per-statement latency and VM counters on this connection,
+         * using the default profiler settings.
+         * Defined in <Vsqlite/QueryProfiler.h>.
+         *
+         * @returns The profiler.
+         * @exception SqliteException
+         */
+        QueryProfiler& EnableProfiling(void);
+
+        /**
+         * Stops collecting measurements and unregisters the trace callback.
+         */
+        void DisableProfiling(void);
+
+        /**
+         * Returns the active profiler.
+         *
+         * @returns A pointer to the QueryProfiler, or nullptr if profiling is disabled.
+         */
+        QueryProfiler* GetProfiler(void) const;
+
+        /**
+         * Registers a scalar SQL function. Argument and result types are taken from the
+         * function's signature and converted with ValueBinding. A function whose only
+         * parameter is FunctionValues accepts any number of arguments.
+         * 
+         * Exceptions thrown by the function are reported as SQL errors.
+         * Defined in <Vsqlite/Function.h>.
+         * 
+         * @tparam F A function pointer or non-generic function object.
+         * @param name Function name.
+         * @param function The function. It is copied and destroyed by SQLite.
+         * @param flags Function flags. SQLITE_DETERMINISTIC lets the planner evaluate calls with constant
+         * arguments once and use the function in indexes; SQLITE_INNOCUOUS allows it in triggers, views
+         * and schema definitions while trusted_schema is off. Neither is assumed: a function that
+         * reads clocks, random numbers or global state must not be flagged as deterministic.
+         * The full list of flags can be found at: https://www.sqlite.org/c3ref/c_deterministic.html
+         * @exception std::invalid_argument - The 'name' parameter is an empty string.
+         * @exception SqliteException
+         */
+        template <typename F>
+        void RegisterFunction(const std::string_view name, F&& function, const std::int32_t flags = 0);
+
+        /**
+         * Registers an aggregate SQL function. A new T is constructed for every group; its Step
+         * member function is called for every row and its Final member function returns the result.
+         * If T also has Inverse and Value member functions, it is registered as a window function.
+         * 
+         * Exceptions thrown by T are reported as SQL errors.
+         * Defined in <Vsqlite/Function.h>.
+         * 
+         * @tparam T A type that satisfies IsAggregateFunction.
+         * @param name Function name.
+         * @param flags Function flags. The full list of flags can be found at: https://www.sqlite.org/c3ref/c_deterministic.html
+         * @exception std::invalid_argument - The 'name' parameter is an empty string.
+         * @exception SqliteException
+         */
+        template <typename T>
+        void RegisterAggregate(const std::string_view name, const std::int32_t flags = 0);
+
+        /**
+         * Removes an SQL function.
+         * Defined in <Vsqlite/Function.h>.
+         * 
+         * @param name Function name.
+         * @param arguments Number of arguments the function was registered with, or -1 for any number.
+         * @exception std::invalid_argument - The 'name' parameter is an empty string.
+         * @exception SqliteException
+         */
+        void UnregisterFunction(const std::string_view name, const std::int32_t arguments);
+
+        /**
+         * Exposes a container as a read-only virtual table, so that it can be queried and
+         * joined against other tables without copying it into the database.
+         * 
+         * The container can be a range of structs mapped with VSQLITE_MAP, whose elements
+         * are rows and whose indices are rowids, or a map whose mapped type is such a struct,
+         * whose keys are exposed as the first column. Equality constraints on the key,
+         * and range constraints on the key of an ordered map or on the rowid of a
+         * random access range, are looked up in the container instead of scanning it.
+         * Defined in <Vsqlite/VirtualTable.h>.
+         * 
+         * @tparam C Container type.
+         * @param name Module name. An eponymous table can be queried directly under this name.
+         * @param container The container. It is not copied and must outlive the database connection,
+         * and must not be modified while a statement reads from the table.
+         * @param options Table options.
+         * @exception std::invalid_argument - The 'name' parameter is an empty string.
+         * @exception SqliteException
+         */
+        template <typename C>
+        void RegisterVirtualTable(const std::string_view name, const C& container, const VirtualTableOptions& options);
+
+        /**
+         * Exposes a container as a read-only eponymous virtual table.
+         * Defined in <Vsqlite/VirtualTable.h>.
+         * 
+         * @tparam C Container type.
+         * @param name Table name.
+         * @param container The container. It is not copied and must outlive the database connection,
+         * and must not be modified while a statement reads from the table.
+         * @exception std::invalid_argument - The 'name' parameter is an empty string.
+         * @exception SqliteException
+         */
+        template <typename C>
+        void RegisterVirtualTable(const std::string_view name, const C& container);
+
+        /**
+         * Inserts every row of a range through a single prepared statement,
+         * grouping the rows into transactions as described by the options.
+         * Defined in <Vsqlite/BulkInserter.h>.
+         * 
+         * @tparam R An input range of std::tuple rows, structs mapped with VSQLITE_MAP, or single values.
+         * @param sql An INSERT statement.
+         * @param rows The rows to insert.
+         * @param options Transaction chunking options.
+         * @returns The insert counters.
+         * @exception std::invalid_argument
+         * @exception SqliteException
+         */
+        template <std::ranges::input_range R>
+        BulkInsertStatistics InsertMany(const std::string_view sql, R&& rows, const BulkInsertOptions& options);
+
+        /**
+         * Inserts every row of a range through a single prepared statement,
+         * committing every 1000 rows.
+         * Defined in <Vsqlite/BulkInserter.h>.
+         * 
+         * @tparam R An input range of std::tuple rows, structs mapped with VSQLITE_MAP, or single values.
+         * @param sql An INSERT statement.
+         * @param rows The rows to insert.
+         * @returns The insert counters.
+         * @exception std::invalid_argument
+         * @exception SqliteException
+         */
+        template <std::ranges::input_range R>
+        BulkInsertStatistics InsertMany(const std::string_view sql, R&& rows);
+
+        /**
+         * Runs a query on an executor and collects its rows.
+         * 
+         * The statement is prepared through the statement cache. The database must not
+         * be used by anything else until the operation completes.
+         * Defined in <Vsqlite/Async.h>.
+         * 
+         * @tparam Ts... Column types, or a single struct type mapped with VSQLITE_MAP.
+         * @tparam Args...
+         * @param resume The executor that resumes the awaiting coroutine, such as the caller's event loop.
+         * @param sql An SQL statement.
+         * @param args Parameter values. The values are copied; pointed-to and borrowed data must outlive the operation.
+         * @returns An awaitable that yields a vector of std::tuple<Ts...> (or of the mapped struct).
+         * The awaitable throws std::invalid_argument or SqliteException if the query fails.
+         */
+        template <typename... Ts, typename... Args>
+        [[nodiscard]] AsyncOperation<std::vector<typename RowValue<Ts...>::Type>> QueryAsync(Executor& resume, const std::string_view sql, Args&&... args);
+
     };
 
-    inline Database::Database(const std::optional<std::string_view> filename, const std::int32_t flags) {
+    inline sqlite3* Database::GetDatabaseHandle() const {
+        return this->m_pDatabase;
+    }
+
+    inline void Database::ConfigureLookaside(const std::int32_t slotSize, const std::int32_t slotCount) {
+
+        if (slotSize < 0)
+            throw std::invalid_argument("'slotSize': Must not be negative.");
+
+        if (slotCount < 0)
+            throw std::invalid_argument("'slotCount': Must not be negative.");
+
+        const std::int32_t res = sqlite3_db_config(this->m_pDatabase, SQLITE_DBCONFIG_LOOKASIDE, nullptr, slotSize, slotCount);
+        if (res != SQLITE_OK) throw SqliteException("Database::ConfigureLookaside(): Lookaside memory is in use.", res, res);
+
+    }
+
+    inline MemoryStatistics Database::GetMemoryStatistics(const bool reset) const {
+
+        const auto status = [this, reset] (const std::int32_t op, const bool highwater) -> std::int64_t {
+            int current = 0;
+            int high = 0;
+            const std::int32_t res = sqlite3_db_status(this->m_pDatabase, op, &current, &high, (reset ? 1 : 0));
+            if (res != SQLITE_OK) throw SqliteException(this->m_pDatabase);
+            return (highwater ? high : current);
+        };
+
+        MemoryStatistics stats = { };
+        stats.CacheUsed = status(SQLITE_DBSTATUS_CACHE_USED, false);
+        stats.CacheUsedShared = status(SQLITE_DBSTATUS_CACHE_USED_SHARED, false);
+        stats.CacheHits = status(SQLITE_DBSTATUS_CACHE_HIT, false);
+        stats.CacheMisses = status(SQLITE_DBSTATUS_CACHE_MISS, false);
+        stats.CacheWrites = status(SQLITE_DBSTATUS_CACHE_WRITE, false);
+        stats.CacheSpills = status(SQLITE_DBSTATUS_CACHE_SPILL, false);
+        stats.LookasideHits = status(SQLITE_DBSTATUS_LOOKASIDE_HIT, true);
+        stats.LookasideMissSize = status(SQLITE_DBSTATUS_LOOKASIDE_MISS_SIZE, true);
+        stats.LookasideMissFull = status(SQLITE_DBSTATUS_LOOKASIDE_MISS_FULL, true);
+        stats.SchemaUsed = status(SQLITE_DBSTATUS_SCHEMA_USED, false);
+        stats.StatementUsed = status(SQLITE_DBSTATUS_STMT_USED, false);
+
+        // Read last: resetting LOOKASIDE_USED clears the highwater mark.
+        int current = 0;
+        int high = 0;
+        if (sqlite3_db_status(this->m_pDatabase, SQLITE_DBSTATUS_LOOKASIDE_USED, &current, &high, (reset ? 1 : 0)) != SQLITE_OK)
+            throw SqliteException(this->m_pDatabase);
+
+        stats.LookasideUsed = current;
+        stats.LookasideHighwater = high;
+
+        return stats;
+    }
+
+    inline void Database::ReleaseMemory() {
+        const std::int32_t res = sqlite3_db_release_memory(this->m_pDatabase);
+        if (res != SQLITE_OK) throw SqliteException(this->m_pDatabase);
+    }
+
+    inline std::int64_t Database::SetSoftHeapLimit(const std::int64_t bytes) {
+
+        if (bytes < 0)
+            throw std::invalid_argument("'bytes': Must not be negative.");
+
+        return sqlite3_soft_heap_limit64(bytes);
+    }
+
+    inline std::int64_t Database::GetSoftHeapLimit() {
+        return sqlite3_soft_heap_limit64(-1);
+    }
+
+    inline std::int64_t Database::SetHardHeapLimit(const std::int64_t bytes) {
+
+        if (bytes < 0)
+            throw std::invalid_argument("'bytes': Must not be negative.");
+
+        return sqlite3_hard_heap_limit64(bytes);
+    }
+
+}
+
+#include <Vsqlite/Statement.h>
+#include <Vsqlite/StatementCache.h>
+
+namespace Vsqlite { 
+
+    inline Database::Database(const std::optional<std::string_view> filename, const std::int32_t flags)
+        : m_pDatabase(nullptr), m_pImage(nullptr) {
 
         if (filename.has_value() && filename->empty())
             throw std::invalid_argument("'filename': Empty string.");
@@ -89,49 +646,58 @@ namespace Vsqlite {
             throw ex;
         }
 
+        this->m_pStatementCache = std::make_unique<StatementCache>(this->m_pDatabase);
+
     }
 
-    inline Database::Database(Database&& database) noexcept {
-        this->m_pDatabase = nullptr;
+    inline Database::Database(const std::optional<std::string_view> filename, const std::int32_t flags, const DatabaseOptions& options)
+        : Database(filename, flags) {
+        this->Configure(options);
+    }
+
+    inline Database::Database(Database&& database) noexcept
+        : m_pDatabase(nullptr), m_pImage(nullptr) {
         this->operator= (std::move(database));
     }
 
     inline Database::~Database() {
 
+        this->m_pStatementCache.reset();
+        this->m_pProfiler.reset();
+
         if (this->m_pDatabase) {
             sqlite3_close_v2(this->m_pDatabase);
             this->m_pDatabase = nullptr;
         }
 
+        this->m_pImage = nullptr;
+
     }
 
     inline Database& Database::operator= (Database&& database) noexcept {
 
         if (this != &database) {
 
+            this->m_pStatementCache.reset();
+            this->m_pProfiler.reset();
+
             if (this->m_pDatabase) {
                 sqlite3_close_v2(this->m_pDatabase);
                 this->m_pDatabase = nullptr;
             }
 
             this->m_pDatabase = database.m_pDatabase;
+            this->m_pStatementCache = std::move(database.m_pStatementCache);
+            this->m_pProfiler = std::move(database.m_pProfiler);
+            this->m_pImage = database.m_pImage;
             database.m_pDatabase = nullptr;
+            database.m_pImage = nullptr;
 
         }
 
         return static_cast<Database&>(*this);
     }
 
-    sqlite3* Database::GetDatabaseHandle() const {
-        return this->m_pDatabase;
-    }
-
-}
-
-#include <Vsqlite/Statement.h>
-
-namespace Vsqlite { 
-
     inline Statement Database::PrepareStatement(const std::string_view sql, const std::int32_t flags) {
         return Statement(static_cast<Database&>(*this), sql, flags);
     }
@@ -142,6 +708,108 @@ namespace Vsqlite {
         return s;
     }
 
+    inline void Database::Configure(const DatabaseOptions& options) {
+
+        const auto pragma = [this] (const std::string_view name, const std::int64_t value) {
+            this->Execute("PRAGMA " + std::string(name) + "=" + std::to_string(value) + ";");
+        };
+
+        // The busy handler goes first: journal_mode and page_size take locks and would otherwise
+        // fail immediately with SQLITE_BUSY while another connection is using the database.
+        if (options.BusyTimeout.has_value()) {
+            const std::int32_t res = sqlite3_busy_timeout(this->m_pDatabase, options.BusyTimeout.value());
+            if (res != SQLITE_OK) throw SqliteException(this->m_pDatabase);
+        }
+
+        // page_size must precede journal_mode: it cannot change once the database is in WAL mode.
+        if (options.PageSize.has_value()) pragma("page_size", options.PageSize.value());
+
+        if (options.Journal.has_value()) {
+
+            const std::string_view requested = DatabaseOptions::JournalModeNames[static_cast<std::size_t>(options.Journal.value())];
+
+            std::string journalMode = { };
+            this->Execute("PRAGMA journal_mode=" + std::string(requested) + ";").Fetch(journalMode);
+            if (journalMode != requested)
+                throw std::invalid_argument("'options': The database does not support the requested journal mode.");
+
+        }
+
+        if (options.Synchronous.has_value()) pragma("synchronous", static_cast<std::int64_t>(options.Synchronous.value()));
+        if (options.CacheSize.has_value()) pragma("cache_size", options.CacheSize.value());
+        if (options.MmapSize.has_value()) pragma("mmap_size", options.MmapSize.value());
+        if (options.TempStore.has_value()) pragma("temp_store", static_cast<std::int64_t>(options.TempStore.value()));
+
+    }
+
+    inline DatabaseOptions Database::GetSettings() const {
+
+        const auto query = [this] (const std::string_view sql) -> std::optional<std::int64_t> {
+            Statement s = { this->m_pDatabase, sql, 0 };
+            std::int64_t value = 0;
+            if (s.Fetch(value)) return value;
+            return std::nullopt;
+        };
+
+        DatabaseOptions settings = { };
+
+        if (const auto pageSize = query("PRAGMA page_size;")) settings.PageSize = static_cast<std::int32_t>(pageSize.value());
+
+        {
+            Statement s = { this->m_pDatabase, "PRAGMA journal_mode;", 0 };
+            std::string journalMode = { };
+            if (s.Fetch(journalMode)) {
+                const auto& names = DatabaseOptions::JournalModeNames;
+                const auto it = std::find(names.begin(), names.end(), journalMode);
+                if (it != names.end()) settings.Journal = static_cast<JournalMode>(it - names.begin());
+            }
+        }
+
+        if (const auto synchronous = query("PRAGMA synchronous;")) settings.Synchronous = static_cast<SynchronousMode>(synchronous.value());
+        settings.CacheSize = query("PRAGMA cache_size;");
+        settings.MmapSize = query("PRAGMA mmap_size;");
+        if (const auto tempStore = query("PRAGMA temp_store;")) settings.TempStore = static_cast<TempStoreMode>(tempStore.value());
+        if (const auto busyTimeout = query("PRAGMA busy_timeout;")) settings.BusyTimeout = static_cast<std::int32_t>(busyTimeout.value());
+
+        return settings;
+    }
+
+    inline std::int64_t Database::SetMmapSize(const std::int64_t bytes) {
+
+        if (bytes < 0)
+            throw std::invalid_argument("'bytes': Must not be negative.");
+
+        std::int64_t size = 0;
+        this->Execute("PRAGMA mmap_size=" + std::to_string(bytes) + ";").Fetch(size);
+
+        return size;
+    }
+
+    inline std::int64_t Database::GetMmapSize() const {
+
+        Statement s = { this->m_pDatabase, "PRAGMA mmap_size;", 0 };
+        std::int64_t size = 0;
+        s.Fetch(size);
+
+        return size;
+    }
+
+    inline CachedStatement Database::Cached(const std::string_view sql) {
+        return this->m_pStatementCache->Acquire(sql);
+    }
+
+    inline StatementCache& Database::GetStatementCache() {
+        return *this->m_pStatementCache;
+    }
+
+    inline void Database::DisableProfiling() {
+        this->m_pProfiler.reset();
+    }
+
+    inline QueryProfiler* Database::GetProfiler() const {
+        return this->m_pProfiler.get();
+    }
+
 }
 
 #endif // _VSQLITE_DATABASE_H_
\ No newline at end of file
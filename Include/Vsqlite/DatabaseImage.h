@@ -0,0 +1,391 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#ifndef _VSQLITE_DATABASEIMAGE_H_
+#define _VSQLITE_DATABASEIMAGE_H_
+
+#include <Vsqlite/SQLite.h>
+#include <Vsqlite/SqliteException.h>
+#include <Vsqlite/Database.h>
+
+#include <string>
+#include <string_view>
+#include <span>
+#include <memory>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <fstream>
+#include <algorithm>
+#include <stdexcept>
+#include <cstdint>
+#include <cstddef>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
+namespace Vsqlite {
+
+    /**
+     * How a database file is brought into memory.
+     */
+    enum class ImageLoadMode : std::int32_t {
+
+        /**
+         * Map the file copy-on-write. Pages are read from disk on first access, unless prefetched.
+         */
+        Map = 0,
+
+        /**
+         * Read the whole file into a buffer.
+         */
+        Read = 1,
+
+    };
+
+    /**
+     * Controls how Database::OpenImage loads a database file.
+     */
+    struct ImageOptions {
+
+        ImageLoadMode Mode = ImageLoadMode::Map;
+
+        /**
+         * Number of threads that touch every page of the image before the database is opened.
+         * Zero disables the warmup.
+         */
+        std::size_t PrefetchThreads = 0;
+
+    };
+
+    /**
+     * DatabaseImage measurements.
+     */
+    struct ImageStatistics {
+
+        std::int64_t Bytes;
+        bool Mapped;
+
+        /**
+         * Time spent mapping or reading the file.
+         */
+        std::chrono::nanoseconds LoadTime;
+
+        /**
+         * Time spent prefetching pages.
+         */
+        std::chrono::nanoseconds PrefetchTime;
+
+        /**
+         * Time from the start of Database::OpenImage until the database was ready for queries.
+         */
+        std::chrono::nanoseconds OpenTime;
+
+    };
+
+    /**
+     * Represents the contents of a database file held in memory, either mapped or read.
+     * Used by Database::OpenImage, which hands it to the connection so that it outlives
+     * any statement that is still reading from it.
+     */
+    class DatabaseImage {
+
+    private:
+        std::byte* m_pData;
+        std::size_t m_size;
+        std::unique_ptr<std::byte[]> m_pBuffer;
+        ImageStatistics m_statistics;
+
+        friend class Database;
+
+        void Map(const std::string& filename);
+        void Read(const std::string& filename);
+        void Unmap(void);
+
+    public:
+
+        /**
+         * Loads a database file.
+         *
+         * @param filename Path of the database file.
+         * @param mode How the file is brought into memory.
+         * @exception std::invalid_argument - The 'filename' parameter is an empty string.
+         * @exception SqliteException - The file cannot be opened, mapped or read.
+         */
+        DatabaseImage(const std::string_view filename, const ImageLoadMode mode);
+
+        DatabaseImage(const DatabaseImage&) = delete;
+        DatabaseImage(DatabaseImage&&) = delete;
+        virtual ~DatabaseImage(void);
+
+        DatabaseImage& operator= (const DatabaseImage&) = delete;
+        DatabaseImage& operator= (DatabaseImage&&) = delete;
+
+        /**
+         * Touches every page of the image so that later queries do not wait for disk reads.
+         *
+         * @param threads Number of threads. Each touches a contiguous part of the image.
+         * @exception std::invalid_argument - The 'threads' parameter is zero.
+         */
+        void Prefetch(const std::size_t threads);
+
+        std::span<const std::byte> GetData(void) const;
+        ImageStatistics GetStatistics(void) const;
+
+    };
+
+    inline DatabaseImage::DatabaseImage(const std::string_view filename, const ImageLoadMode mode)
+        : m_pData(nullptr), m_size(0), m_pBuffer(nullptr), m_statistics({ }) {
+
+        if (filename.empty())
+            throw std::invalid_argument("'filename': Empty string.");
+
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        if (mode == ImageLoadMode::Map) this->Map(std::string(filename));
+        else this->Read(std::string(filename));
+
+        // In-memory databases cannot use WAL, so images of WAL databases are switched to
+        // rollback journal mode (file format read/write versions at offsets 18 and 19).
+        // For a mapping, this only copies the first page.
+        if ((this->m_size >= 20) && (this->m_pData[18] == std::byte(2)) && (this->m_pData[19] == std::byte(2))) {
+            this->m_pData[18] = std::byte(1);
+            this->m_pData[19] = std::byte(1);
+        }
+
+        this->m_statistics.Bytes = static_cast<std::int64_t>(this->m_size);
+        this->m_statistics.Mapped = (mode == ImageLoadMode::Map);
+        this->m_statistics.LoadTime = (std::chrono::steady_clock::now() - start);
+
+    }
+
+    inline DatabaseImage::~DatabaseImage() {
+        if (this->m_statistics.Mapped) this->Unmap();
+    }
+
+#ifdef _WIN32
+
+    inline void DatabaseImage::Map(const std::string& filename) {
+
+        const HANDLE hFile = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (hFile == INVALID_HANDLE_VALUE)
+            throw SqliteException(("DatabaseImage::Map(): Cannot open '" + filename + "'."), SQLITE_CANTOPEN, SQLITE_CANTOPEN);
+
+        LARGE_INTEGER size = { };
+        if (!GetFileSizeEx(hFile, &size)) {
+            CloseHandle(hFile);
+            throw SqliteException(("DatabaseImage::Map(): Cannot get the size of '" + filename + "'."), SQLITE_IOERR, SQLITE_IOERR_FSTAT);
+        }
+
+        this->m_size = static_cast<std::size_t>(size.QuadPart);
+        if (this->m_size == 0) {
+            CloseHandle(hFile);
+            return;
+        }
+
+        const HANDLE hMapping = CreateFileMappingA(hFile, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        CloseHandle(hFile);
+
+        if (!hMapping)
+            throw SqliteException(("DatabaseImage::Map(): Cannot map '" + filename + "'."), SQLITE_IOERR, SQLITE_IOERR_MMAP);
+
+        // The view keeps the mapping object alive.
+        this->m_pData = static_cast<std::byte*>(MapViewOfFile(hMapping, FILE_MAP_COPY, 0, 0, 0));
+        CloseHandle(hMapping);
+
+        if (!this->m_pData)
+            throw SqliteException(("DatabaseImage::Map(): Cannot map '" + filename + "'."), SQLITE_IOERR, SQLITE_IOERR_MMAP);
+
+    }
+
+    inline void DatabaseImage::Unmap() {
+
+        if (this->m_pData) {
+            UnmapViewOfFile(this->m_pData);
+            this->m_pData = nullptr;
+        }
+
+    }
+
+#else
+
+    inline void DatabaseImage::Map(const std::string& filename) {
+
+        const int fd = open(filename.c_str(), O_RDONLY);
+        if (fd < 0)
+            throw SqliteException(("DatabaseImage::Map(): Cannot open '" + filename + "': " + std::strerror(errno) + "."), SQLITE_CANTOPEN, SQLITE_CANTOPEN);
+
+        struct stat info = { };
+        if (fstat(fd, &info) != 0) {
+            const int error = errno;
+            close(fd);
+            throw SqliteException(("DatabaseImage::Map(): Cannot get the size of '" + filename + "': " + std::strerror(error) + "."), SQLITE_IOERR, SQLITE_IOERR_FSTAT);
+        }
+
+        this->m_size = static_cast<std::size_t>(info.st_size);
+        if (this->m_size == 0) {
+            close(fd);
+            return;
+        }
+
+        // Private and writable, so that the header can be patched without touching the file.
+        void* pData = mmap(nullptr, this->m_size, (PROT_READ | PROT_WRITE), MAP_PRIVATE, fd, 0);
+        const int error = errno;
+        close(fd);
+
+        if (pData == MAP_FAILED)
+            throw SqliteException(("DatabaseImage::Map(): Cannot map '" + filename + "': " + std::strerror(error) + "."), SQLITE_IOERR, SQLITE_IOERR_MMAP);
+
+        this->m_pData = static_cast<std::byte*>(pData);
+
+    }
+
+    inline void DatabaseImage::Unmap() {
+
+        if (this->m_pData) {
+            munmap(this->m_pData, this->m_size);
+            this->m_pData = nullptr;
+        }
+
+    }
+
+#endif
+
+    inline void DatabaseImage::Read(const std::string& filename) {
+
+        std::ifstream file = std::ifstream(filename, (std::ios::binary | std::ios::ate));
+        if (!file.is_open())
+            throw SqliteException(("DatabaseImage::Read(): Cannot open '" + filename + "'."), SQLITE_CANTOPEN, SQLITE_CANTOPEN);
+
+        this->m_size = static_cast<std::size_t>(file.tellg());
+        this->m_pBuffer = std::make_unique_for_overwrite<std::byte[]>(this->m_size);
+        this->m_pData = this->m_pBuffer.get();
+
+        file.seekg(0);
+        if (!file.read(reinterpret_cast<char*>(this->m_pData), static_cast<std::streamsize>(this->m_size)))
+            throw SqliteException(("DatabaseImage::Read(): Cannot read '" + filename + "'."), SQLITE_IOERR, SQLITE_IOERR_READ);
+
+    }
+
+    inline void DatabaseImage::Prefetch(const std::size_t threads) {
+
+        if (threads == 0)
+            throw std::invalid_argument("'threads': Must be greater than zero.");
+
+        if (this->m_size == 0) return;
+
+        constexpr std::size_t PageSize = 4096;
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+#ifndef _WIN32
+        if (this->m_statistics.Mapped) madvise(this->m_pData, this->m_size, MADV_WILLNEED);
+#endif
+
+        const auto touch = [this] (const std::size_t begin, const std::size_t end) {
+            std::uint8_t sum = 0;
+            for (std::size_t i = begin; i < end; i += PageSize)
+                sum += std::to_integer<std::uint8_t>(this->m_pData[i]);
+            [[maybe_unused]] volatile const std::uint8_t sink = sum;
+        };
+
+        const std::size_t pages = ((this->m_size + PageSize - 1) / PageSize);
+        const std::size_t count = (std::min)(threads, pages);
+        const std::size_t pagesPerThread = ((pages + count - 1) / count);
+
+        std::vector<std::thread> workers = { };
+        workers.reserve(count - 1);
+
+        for (std::size_t t = 1; t < count; ++t) {
+            const std::size_t begin = (std::min)((t * pagesPerThread * PageSize), this->m_size);
+            const std::size_t end = (std::min)(((t + 1) * pagesPerThread * PageSize), this->m_size);
+            workers.emplace_back(touch, begin, end);
+        }
+
+        touch(0, (std::min)((pagesPerThread * PageSize), this->m_size));
+        for (std::thread& worker : workers) worker.join();
+
+        this->m_statistics.PrefetchTime = (std::chrono::steady_clock::now() - start);
+
+    }
+
+    inline std::span<const std::byte> DatabaseImage::GetData() const {
+        return { this->m_pData, this->m_size };
+    }
+
+    inline ImageStatistics DatabaseImage::GetStatistics() const {
+        return this->m_statistics;
+    }
+
+    inline Database Database::OpenImage(const std::string_view filename, const ImageOptions& options) {
+
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        std::unique_ptr<DatabaseImage> pOwner = std::make_unique<DatabaseImage>(filename, options.Mode);
+        if (options.PrefetchThreads > 0) pOwner->Prefetch(options.PrefetchThreads);
+
+        Database database = { std::nullopt, (SQLITE_OPEN_READONLY | SQLITE_OPEN_MEMORY) };
+
+        // The image is owned by a function of the connection, whose destructor runs only once the
+        // connection is really closed: sqlite3_close_v2 keeps it open while statements are unfinalized.
+        // SQLite calls the destructor if registration fails as well.
+        DatabaseImage* const pImage = pOwner.release();
+        std::int32_t res = sqlite3_create_function_v2(
+            database.m_pDatabase,
+            "vsqlite_image",
+            0,
+            (SQLITE_UTF8 | SQLITE_DIRECTONLY),
+            pImage,
+            [] (sqlite3_context* pContext, int, sqlite3_value**) { sqlite3_result_null(pContext); },
+            nullptr,
+            nullptr,
+            [] (void* pImage) { delete static_cast<DatabaseImage*>(pImage); }
+        );
+
+        if (res != SQLITE_OK) throw SqliteException(database.m_pDatabase);
+
+        // Read-only and without FREEONCLOSE: SQLite uses the image in place and never frees it.
+        res = sqlite3_deserialize(
+            database.m_pDatabase,
+            "main",
+            reinterpret_cast<unsigned char*>(pImage->m_pData),
+            static_cast<sqlite3_int64>(pImage->m_size),
+            static_cast<sqlite3_int64>(pImage->m_size),
+            SQLITE_DESERIALIZE_READONLY
+        );
+
+        if (res != SQLITE_OK) throw SqliteException(database.m_pDatabase);
+
+        pImage->m_statistics.OpenTime = (std::chrono::steady_clock::now() - start);
+        database.m_pImage = pImage;
+
+        return database;
+    }
+
+    inline Database Database::OpenImage(const std::string_view filename) {
+        return OpenImage(filename, ImageOptions { });
+    }
+
+    inline const DatabaseImage* Database::GetImage() const {
+        return this->m_pImage;
+    }
+
+}
+
+#endif // _VSQLITE_DATABASEIMAGE_H_
\ No newline at end of file
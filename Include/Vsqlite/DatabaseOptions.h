@@ -0,0 +1,174 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#ifndef _VSQLITE_DATABASEOPTIONS_H_
+#define _VSQLITE_DATABASEOPTIONS_H_
+
+#include <array>
+#include <optional>
+#include <string_view>
+#include <cstdint>
+
+namespace Vsqlite {
+
+    /**
+     * Journal modes.
+     * More info: https://www.sqlite.org/pragma.html#pragma_journal_mode
+     */
+    enum class JournalMode : std::int32_t {
+        Delete = 0,
+        Truncate = 1,
+        Persist = 2,
+        Memory = 3,
+        Wal = 4,
+        Off = 5,
+    };
+
+    /**
+     * Synchronous modes.
+     * More info: https://www.sqlite.org/pragma.html#pragma_synchronous
+     */
+    enum class SynchronousMode : std::int32_t {
+        Off = 0,
+        Normal = 1,
+        Full = 2,
+        Extra = 3,
+    };
+
+    /**
+     * Temporary storage locations.
+     * More info: https://www.sqlite.org/pragma.html#pragma_temp_store
+     */
+    enum class TempStoreMode : std::int32_t {
+        Default = 0,
+        File = 1,
+        Memory = 2,
+    };
+
+    /**
+     * Connection settings applied when a database is opened.
+     * Settings that are not set keep their SQLite defaults.
+     */
+    struct DatabaseOptions {
+
+        /**
+         * Journal mode names, indexed by JournalMode.
+         */
+        static constexpr std::array<std::string_view, 6> JournalModeNames = { "delete", "truncate", "persist", "memory", "wal", "off" };
+
+        /**
+         * Page size in bytes. Only takes effect on a new database, before WAL mode is enabled.
+         */
+        std::optional<std::int32_t> PageSize = std::nullopt;
+
+        std::optional<JournalMode> Journal = std::nullopt;
+        std::optional<SynchronousMode> Synchronous = std::nullopt;
+
+        /**
+         * Page cache size. A positive value is a number of pages;
+         * a negative value is a size in KiB.
+         */
+        std::optional<std::int64_t> CacheSize = std::nullopt;
+
+        /**
+         * Maximum number of bytes of the database file accessed through memory mapping.
+         * Zero disables memory-mapped I/O.
+         */
+        std::optional<std::int64_t> MmapSize = std::nullopt;
+
+        std::optional<TempStoreMode> TempStore = std::nullopt;
+
+        /**
+         * Busy timeout in milliseconds.
+         */
+        std::optional<std::int32_t> BusyTimeout = std::nullopt;
+
+        /**
+         * Settings for a database with frequent, concurrent writes:
+         * WAL, synchronous NORMAL, a 64 MiB cache, 256 MiB mmap and a 5 second busy timeout.
+         *
+         * @returns A DatabaseOptions.
+         */
+        static DatabaseOptions WriteHeavy(void);
+
+        /**
+         * Settings for a database that is mostly read by many connections:
+         * WAL, synchronous NORMAL, a 128 MiB cache, 1 GiB mmap and a 5 second busy timeout.
+         *
+         * @returns A DatabaseOptions.
+         */
+        static DatabaseOptions ReadMostly(void);
+
+        /**
+         * Settings for scratch data that need not survive a crash:
+         * in-memory journal, synchronous OFF, in-memory temporary storage.
+         *
+         * @returns A DatabaseOptions.
+         */
+        static DatabaseOptions Ephemeral(void);
+
+        /**
+         * Settings for loading large amounts of data into a database that can be
+         * rebuilt if the load is interrupted: in-memory journal, synchronous OFF,
+         * a 256 MiB cache and in-memory temporary storage.
+         *
+         * @returns A DatabaseOptions.
+         */
+        static DatabaseOptions BulkLoad(void);
+
+    };
+
+    inline DatabaseOptions DatabaseOptions::WriteHeavy() {
+
+        DatabaseOptions options = { };
+        options.Journal = JournalMode::Wal;
+        options.Synchronous = SynchronousMode::Normal;
+        options.CacheSize = -(64 * 1024);
+        options.MmapSize = (256ll * 1024 * 1024);
+        options.TempStore = TempStoreMode::Memory;
+        options.BusyTimeout = 5000;
+
+        return options;
+    }
+
+    inline DatabaseOptions DatabaseOptions::ReadMostly() {
+
+        DatabaseOptions options = { };
+        options.Journal = JournalMode::Wal;
+        options.Synchronous = SynchronousMode::Normal;
+        options.CacheSize = -(128 * 1024);
+        options.MmapSize = (1024ll * 1024 * 1024);
+        options.TempStore = TempStoreMode::Memory;
+        options.BusyTimeout = 5000;
+
+        return options;
+    }
+
+    inline DatabaseOptions DatabaseOptions::Ephemeral() {
+
+        DatabaseOptions options = { };
+        options.Journal = JournalMode::Memory;
+        options.Synchronous = SynchronousMode::Off;
+        options.TempStore = TempStoreMode::Memory;
+
+        return options;
+    }
+
+    inline DatabaseOptions DatabaseOptions::BulkLoad() {
+
+        DatabaseOptions options = { };
+        options.Journal = JournalMode::Memory;
+        options.Synchronous = SynchronousMode::Off;
+        options.CacheSize = -(256 * 1024);
+        options.TempStore = TempStoreMode::Memory;
+        options.BusyTimeout = 5000;
+
+        return options;
+    }
+
+}
+
+#endif // _VSQLITE_DATABASEOPTIONS_H_
\ No newline at end of file
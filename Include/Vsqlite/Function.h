@@ -0,0 +1,336 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#ifndef _VSQLITE_FUNCTION_H_
+#define _VSQLITE_FUNCTION_H_
+
+#include <Vsqlite/SQLite.h>
+#include <Vsqlite/SqliteException.h>
+#include <Vsqlite/ValueBinding.h>
+#include <Vsqlite/Database.h>
+
+#include <string>
+#include <string_view>
+#include <span>
+#include <tuple>
+#include <memory>
+#include <functional>
+#include <type_traits>
+#include <concepts>
+#include <utility>
+#include <exception>
+#include <new>
+#include <stdexcept>
+#include <cstdint>
+#include <cstddef>
+
+namespace Vsqlite {
+
+    /**
+     * Result and argument types of a function pointer, member function pointer or
+     * non-generic function object.
+     */
+    template <typename F>
+    struct FunctionTraits : FunctionTraits<decltype(&std::remove_cvref_t<F>::operator())> { };
+
+    template <typename R, typename... Args>
+    struct FunctionTraits<R (*)(Args...)> {
+        using Result = R;
+        using Arguments = std::tuple<Args...>;
+    };
+
+    template <typename R, typename... Args>
+    struct FunctionTraits<R (*)(Args...) noexcept> : FunctionTraits<R (*)(Args...)> { };
+
+    template <typename R, typename C, typename... Args>
+    struct FunctionTraits<R (C::*)(Args...)> : FunctionTraits<R (*)(Args...)> { };
+
+    template <typename R, typename C, typename... Args>
+    struct FunctionTraits<R (C::*)(Args...) const> : FunctionTraits<R (*)(Args...)> { };
+
+    template <typename R, typename C, typename... Args>
+    struct FunctionTraits<R (C::*)(Args...) noexcept> : FunctionTraits<R (*)(Args...)> { };
+
+    template <typename R, typename C, typename... Args>
+    struct FunctionTraits<R (C::*)(Args...) const noexcept> : FunctionTraits<R (*)(Args...)> { };
+
+    /**
+     * The argument type of a function that takes any number of arguments.
+     */
+    using FunctionValues = std::span<sqlite3_value* const>;
+
+    /**
+     * An aggregate SQL function: a default-constructible type with a Step member function,
+     * called once per row with the function's arguments, and a Final member function,
+     * which returns the result.
+     */
+    template <typename T>
+    concept IsAggregateFunction = std::default_initializable<T> && requires {
+        &T::Step;
+        &T::Final;
+    };
+
+    /**
+     * An aggregate SQL function that can also be used as a window function: it additionally
+     * has an Inverse member function, which removes a row added by Step, and a Value
+     * member function, which returns the current result.
+     */
+    template <typename T>
+    concept IsWindowFunction = IsAggregateFunction<T> && requires {
+        &T::Inverse;
+        &T::Value;
+    };
+
+    /**
+     * Decodes SQL function arguments and reports results and errors.
+     */
+    template <typename Arguments>
+    struct FunctionCall;
+
+    template <typename... Args>
+    struct FunctionCall<std::tuple<Args...>> {
+
+        using Values = std::tuple<std::decay_t<Args>...>;
+
+        /**
+         * Number of SQL arguments, or -1 if the function takes FunctionValues.
+         */
+        static constexpr std::int32_t ArgumentCount =
+            ((std::tuple_size_v<Values> == 1) && std::is_same_v<std::tuple_element_t<0, std::tuple<std::decay_t<Args>..., void>>, FunctionValues>)
+            ? -1
+            : static_cast<std::int32_t>(sizeof...(Args));
+
+        static Values Decode(const std::int32_t argc, sqlite3_value** const argv) {
+
+            Values values = { };
+
+            if constexpr (ArgumentCount == -1)
+                std::get<0>(values) = FunctionValues(argv, static_cast<std::size_t>(argc));
+            else {
+                [&] <std::size_t... Is> (std::index_sequence<Is...>) {
+                    (ValueBinding<std::tuple_element_t<Is, Values>>::Value(argv[Is], std::get<Is>(values)), ...);
+                }(std::index_sequence_for<Args...> { });
+            }
+
+            return values;
+        }
+
+        /**
+         * Calls a function with decoded arguments and sets its return value as the result.
+         */
+        template <typename F>
+        static void Invoke(sqlite3_context* const pContext, F&& function, const std::int32_t argc, sqlite3_value** const argv) {
+
+            Values values = Decode(argc, argv);
+            using R = decltype(std::apply(std::forward<F>(function), values));
+
+            if constexpr (std::is_void_v<R>) std::apply(std::forward<F>(function), values);
+            else SetResult(pContext, std::apply(std::forward<F>(function), values));
+
+        }
+
+        template <typename R>
+        static void SetResult(sqlite3_context* const pContext, const R& result) {
+            ValueBinding<std::decay_t<R>>::Result(pContext, result);
+        }
+
+        /**
+         * Reports the exception being handled as the function's error.
+         */
+        static void SetError(sqlite3_context* const pContext) noexcept {
+
+            try {
+                throw;
+            }
+            catch (const std::bad_alloc&) {
+                sqlite3_result_error_nomem(pContext);
+            }
+            catch (const SqliteException& ex) {
+                sqlite3_result_error(pContext, ex.what(), -1);
+                sqlite3_result_error_code(pContext, ex.GetExtendedErrorCode());
+            }
+            catch (const std::exception& ex) {
+                sqlite3_result_error(pContext, ex.what(), -1);
+            }
+            catch (...) {
+                sqlite3_result_error(pContext, "Unknown exception.", -1);
+            }
+
+        }
+
+    };
+
+    /**
+     * sqlite3_create_function_v2 callbacks of a scalar function.
+     */
+    template <typename F>
+    struct ScalarFunction {
+
+        using Call = FunctionCall<typename FunctionTraits<F>::Arguments>;
+
+        static void Invoke(sqlite3_context* pContext, int argc, sqlite3_value** argv) {
+            try {
+                Call::Invoke(pContext, *static_cast<F*>(sqlite3_user_data(pContext)), argc, argv);
+            }
+            catch (...) {
+                Call::SetError(pContext);
+            }
+        }
+
+        static void Destroy(void* pFunction) {
+            delete static_cast<F*>(pFunction);
+        }
+
+    };
+
+    /**
+     * sqlite3_create_function_v2 and sqlite3_create_window_function callbacks of an aggregate function.
+     * The state object is created on the first row and destroyed by Final.
+     */
+    template <IsAggregateFunction T>
+    struct AggregateFunction {
+
+        using Call = FunctionCall<typename FunctionTraits<decltype(&T::Step)>::Arguments>;
+
+        static T* GetState(sqlite3_context* const pContext) {
+
+            T** ppState = static_cast<T**>(sqlite3_aggregate_context(pContext, sizeof(T*)));
+            if (!ppState) throw std::bad_alloc();
+
+            if (!*ppState) *ppState = new T();
+            return *ppState;
+        }
+
+        static void Step(sqlite3_context* pContext, int argc, sqlite3_value** argv) {
+            try {
+                T* pState = GetState(pContext);
+                Call::Invoke(pContext, [pState] (auto&&... args) { pState->Step(std::forward<decltype(args)>(args)...); }, argc, argv);
+            }
+            catch (...) {
+                Call::SetError(pContext);
+            }
+        }
+
+        static void Inverse(sqlite3_context* pContext, int argc, sqlite3_value** argv) {
+            try {
+                T* pState = GetState(pContext);
+                Call::Invoke(pContext, [pState] (auto&&... args) { pState->Inverse(std::forward<decltype(args)>(args)...); }, argc, argv);
+            }
+            catch (...) {
+                Call::SetError(pContext);
+            }
+        }
+
+        static void Value(sqlite3_context* pContext) {
+            try {
+                Call::SetResult(pContext, GetState(pContext)->Value());
+            }
+            catch (...) {
+                Call::SetError(pContext);
+            }
+        }
+
+        static void Final(sqlite3_context* pContext) {
+
+            // No context exists if Step was never called, e.g. for an empty table.
+            T** ppState = static_cast<T**>(sqlite3_aggregate_context(pContext, 0));
+            std::unique_ptr<T> pState = std::unique_ptr<T>(ppState ? *ppState : nullptr);
+            if (ppState) *ppState = nullptr;
+
+            try {
+                if (!pState) pState = std::make_unique<T>();
+                Call::SetResult(pContext, pState->Final());
+            }
+            catch (...) {
+                Call::SetError(pContext);
+            }
+
+        }
+
+    };
+
+    template <typename F>
+    inline void Database::RegisterFunction(const std::string_view name, F&& function, const std::int32_t flags) {
+
+        if (name.empty())
+            throw std::invalid_argument("'name': Empty string.");
+
+        using Function = std::decay_t<F>;
+        using Adapter = ScalarFunction<Function>;
+
+        // SQLite calls the destructor if registration fails as well.
+        const std::int32_t res = sqlite3_create_function_v2(
+            this->m_pDatabase,
+            std::string(name).c_str(),
+            Adapter::Call::ArgumentCount,
+            (SQLITE_UTF8 | flags),
+            new Function(std::forward<F>(function)),
+            &Adapter::Invoke,
+            nullptr,
+            nullptr,
+            &Adapter::Destroy
+        );
+
+        if (res != SQLITE_OK) throw SqliteException(this->m_pDatabase);
+
+    }
+
+    template <typename T>
+    inline void Database::RegisterAggregate(const std::string_view name, const std::int32_t flags) {
+
+        static_assert(IsAggregateFunction<T>, "T must be default-constructible and have Step and Final member functions.");
+
+        if (name.empty())
+            throw std::invalid_argument("'name': Empty string.");
+
+        using Adapter = AggregateFunction<T>;
+        std::int32_t res = SQLITE_OK;
+
+        if constexpr (IsWindowFunction<T>) {
+            res = sqlite3_create_window_function(
+                this->m_pDatabase,
+                std::string(name).c_str(),
+                Adapter::Call::ArgumentCount,
+                (SQLITE_UTF8 | flags),
+                nullptr,
+                &Adapter::Step,
+                &Adapter::Final,
+                &Adapter::Value,
+                &Adapter::Inverse,
+                nullptr
+            );
+        }
+        else {
+            res = sqlite3_create_function_v2(
+                this->m_pDatabase,
+                std::string(name).c_str(),
+                Adapter::Call::ArgumentCount,
+                (SQLITE_UTF8 | flags),
+                nullptr,
+                nullptr,
+                &Adapter::Step,
+                &Adapter::Final,
+                nullptr
+            );
+        }
+
+        if (res != SQLITE_OK) throw SqliteException(this->m_pDatabase);
+
+    }
+
+    inline void Database::UnregisterFunction(const std::string_view name, const std::int32_t arguments) {
+
+        if (name.empty())
+            throw std::invalid_argument("'name': Empty string.");
+
+        const std::int32_t res = sqlite3_create_function_v2(this->m_pDatabase, std::string(name).c_str(), arguments, SQLITE_UTF8, nullptr, nullptr, nullptr, nullptr, nullptr);
+        if (res != SQLITE_OK) throw SqliteException(this->m_pDatabase);
+
+    }
+
+}
+
+#endif // _VSQLITE_FUNCTION_H_
\ No newline at end of file
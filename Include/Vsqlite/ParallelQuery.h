@@ -0,0 +1,370 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#ifndef _VSQLITE_PARALLELQUERY_H_
+#define _VSQLITE_PARALLELQUERY_H_
+
+#include <Vsqlite/SQLite.h>
+#include <Vsqlite/SqliteException.h>
+#include <Vsqlite/Database.h>
+#include <Vsqlite/Statement.h>
+#include <Vsqlite/StatementCache.h>
+#include <Vsqlite/Transaction.h>
+#include <Vsqlite/ConnectionPool.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <optional>
+#include <thread>
+#include <exception>
+#include <stdexcept>
+#include <algorithm>
+#include <utility>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+namespace Vsqlite {
+
+    /**
+     * ParallelQuery settings.
+     */
+    struct ParallelQueryOptions {
+
+        /**
+         * Number of partitions, each run on its own reader and thread.
+         * Zero uses every reader of the pool.
+         */
+        std::size_t Partitions = 0;
+
+    };
+
+    /**
+     * An inclusive range of keys, bound to parameters 1 and 2 of a partitioned query.
+     */
+    struct ParallelQueryPartition {
+        std::int64_t Lower;
+        std::int64_t Upper;
+    };
+
+    /**
+     * Runs a query over an integer key range split into partitions, each on its own
+     * ConnectionPool reader and thread, and merges the partial results with a reducer.
+     *
+     * The query reads the bounds of its partition from parameters 1 and 2, for example
+     * "SELECT Category, sum(Value) FROM Items WHERE rowid BETWEEN ?1 AND ?2 GROUP BY Category;".
+     *
+     * All partitions read the same state of the database. If SQLite is built with
+     * SQLITE_ENABLE_SNAPSHOT, and the macro is defined when including this header, the
+     * readers open a snapshot taken by the first of them. Otherwise, the pool's write connection
+     * is leased while the readers begin their read transactions, so that no commit made through
+     * the pool falls between them; commits made by other connections or processes can, and
+     * the partitions may then see different states.
+     */
+    class ParallelQuery {
+
+    private:
+        ConnectionPool* m_pPool;
+        std::string m_sql;
+        ParallelQueryOptions m_options;
+        std::string m_table;
+        std::string m_column;
+        std::optional<ParallelQueryPartition> m_range;
+
+        /**
+         * Leases the readers and begins a read transaction on each, all on the same snapshot.
+         * Returns the key range to partition, or std::nullopt if it is empty.
+         */
+        std::optional<ParallelQueryPartition> Begin(std::vector<ConnectionLease>& leases, std::vector<Transaction>& transactions) const;
+
+    public:
+
+        /**
+         * Constructs a new ParallelQuery object.
+         *
+         * @param pool A connection pool. It must outlive this object.
+         * @param sql The query. Parameters 1 and 2 receive the bounds of a partition.
+         * @param options Query settings.
+         * @exception std::invalid_argument - The 'sql' parameter is an empty string,
+         * or options.Partitions exceeds the number of readers of the pool.
+         */
+        ParallelQuery(ConnectionPool& pool, const std::string_view sql, const ParallelQueryOptions& options = { });
+
+        /**
+         * Partitions the range between the smallest and the largest rowid of a table.
+         *
+         * @param table Table name.
+         * @returns A reference to this object.
+         * @exception std::invalid_argument - The 'table' parameter is an empty string.
+         */
+        ParallelQuery& ByRowid(const std::string_view table);
+
+        /**
+         * Partitions the range between the smallest and the largest value of an integer column.
+         * The column should be indexed, so that each partition reads only its own rows.
+         *
+         * @param table Table name.
+         * @param column Column name.
+         * @returns A reference to this object.
+         * @exception std::invalid_argument - The 'table' or 'column' parameter is an empty string.
+         */
+        ParallelQuery& ByKey(const std::string_view table, const std::string_view column);
+
+        /**
+         * Partitions an explicit inclusive key range.
+         *
+         * @param first Smallest key.
+         * @param last Largest key.
+         * @returns A reference to this object.
+         * @exception std::invalid_argument - 'first' is greater than 'last'.
+         */
+        ParallelQuery& ByRange(const std::int64_t first, const std::int64_t last);
+
+        /**
+         * Runs the query.
+         *
+         * The map function is called once per partition, on the partition's thread, with the
+         * query prepared on the partition's reader and its bounds bound. Further parameters can be bound
+         * starting at index 3. The partial results are then merged on the calling thread, in partition order,
+         * as result = reduce(std::move(result), std::move(partial)).
+         *
+         * The calling thread must not hold a lease of the pool's write connection.
+         *
+         * @tparam T Result type.
+         * @tparam Map A function object that takes a Statement& and returns a T.
+         * @tparam Reduce A function object that takes two T's and returns a T.
+         * @param initial Initial value of the result, returned as is if the key range is empty.
+         * @param map Computes the result of a partition.
+         * @param reduce Merges two results.
+         * @returns The merged result.
+         * @exception std::logic_error - No key range was specified.
+         * @exception SqliteException
+         * Exceptions thrown by the map function are rethrown once all partitions have finished.
+         */
+        template <typename T, typename Map, typename Reduce>
+        T Run(T initial, Map&& map, Reduce&& reduce);
+
+        /**
+         * Splits an inclusive key range into partitions of nearly equal size.
+         * Partitions are empty (Lower > Upper) if the range has fewer keys than partitions.
+         *
+         * @param first Smallest key.
+         * @param last Largest key.
+         * @param count Number of partitions.
+         * @returns A vector of partitions.
+         * @exception std::invalid_argument - 'first' is greater than 'last', or 'count' is zero.
+         */
+        static std::vector<ParallelQueryPartition> Split(const std::int64_t first, const std::int64_t last, const std::size_t count);
+
+    };
+
+    inline ParallelQuery::ParallelQuery(ConnectionPool& pool, const std::string_view sql, const ParallelQueryOptions& options)
+        : m_pPool(&pool), m_sql(sql), m_options(options) {
+
+        if (sql.empty())
+            throw std::invalid_argument("'sql': Empty string.");
+
+        if (this->m_options.Partitions == 0) this->m_options.Partitions = pool.GetReaderCount();
+
+        // Every partition holds its reader until all of them have begun reading.
+        if (this->m_options.Partitions > pool.GetReaderCount())
+            throw std::invalid_argument("'options': Partitions must not exceed the number of readers.");
+
+    }
+
+    inline ParallelQuery& ParallelQuery::ByRowid(const std::string_view table) {
+        return this->ByKey(table, "rowid");
+    }
+
+    inline ParallelQuery& ParallelQuery::ByKey(const std::string_view table, const std::string_view column) {
+
+        if (table.empty())
+            throw std::invalid_argument("'table': Empty string.");
+
+        if (column.empty())
+            throw std::invalid_argument("'column': Empty string.");
+
+        const auto quote = [] (const std::string_view name) {
+            std::string identifier = "\"";
+            for (const char ch : name) {
+                if (ch == '"') identifier += '"';
+                identifier += ch;
+            }
+            return (identifier + "\"");
+        };
+
+        this->m_table = quote(table);
+        this->m_column = quote(column);
+        this->m_range.reset();
+
+        return static_cast<ParallelQuery&>(*this);
+    }
+
+    inline ParallelQuery& ParallelQuery::ByRange(const std::int64_t first, const std::int64_t last) {
+
+        if (first > last)
+            throw std::invalid_argument("'first': Must not be greater than 'last'.");
+
+        this->m_table.clear();
+        this->m_column.clear();
+        this->m_range = ParallelQueryPartition { first, last };
+
+        return static_cast<ParallelQuery&>(*this);
+    }
+
+    inline std::optional<ParallelQueryPartition> ParallelQuery::Begin(std::vector<ConnectionLease>& leases, std::vector<Transaction>& transactions) const {
+
+        // All readers are leased at once; queries that each held some while waiting for more would deadlock.
+        leases = this->m_pPool->AcquireReaders(this->m_options.Partitions);
+        transactions.reserve(leases.size());
+
+#ifdef SQLITE_ENABLE_SNAPSHOT
+
+        // The first reader keeps its transaction open, so the snapshot cannot be checkpointed away.
+        transactions.emplace_back(*leases[0]);
+        leases[0]->Cached("PRAGMA schema_version;")->Execute();
+
+        sqlite3_snapshot* pSnapshot = nullptr;
+        if (sqlite3_snapshot_get(leases[0]->GetDatabaseHandle(), "main", &pSnapshot) != SQLITE_OK)
+            throw SqliteException(leases[0]->GetDatabaseHandle());
+
+        try {
+
+            for (std::size_t i = 1; i < leases.size(); ++i) {
+                transactions.emplace_back(*leases[i]);
+                if (sqlite3_snapshot_open(leases[i]->GetDatabaseHandle(), "main", pSnapshot) != SQLITE_OK)
+                    throw SqliteException(leases[i]->GetDatabaseHandle());
+            }
+
+        }
+        catch (...) {
+            sqlite3_snapshot_free(pSnapshot);
+            throw;
+        }
+
+        sqlite3_snapshot_free(pSnapshot);
+
+#else
+
+        // A read transaction sees the last commit made before its first read.
+        {
+            const ConnectionLease writer = this->m_pPool->AcquireWriter();
+            for (ConnectionLease& lease : leases) {
+                transactions.emplace_back(*lease);
+                lease->Cached("PRAGMA schema_version;")->Execute();
+            }
+        }
+
+#endif
+
+        if (this->m_range.has_value()) return this->m_range;
+
+        std::optional<std::int64_t> first = std::nullopt;
+        std::optional<std::int64_t> last = std::nullopt;
+
+        {
+            CachedStatement s = leases[0]->Cached("SELECT min(" + this->m_column + "), max(" + this->m_column + ") FROM " + this->m_table + ";");
+            s->Fetch(first, last);
+        }
+
+        if (!first.has_value() || !last.has_value()) return std::nullopt;
+
+        return ParallelQueryPartition { first.value(), last.value() };
+    }
+
+    template <typename T, typename Map, typename Reduce>
+    inline T ParallelQuery::Run(T initial, Map&& map, Reduce&& reduce) {
+
+        if (this->m_table.empty() && !this->m_range.has_value())
+            throw std::logic_error("ParallelQuery::Run(): No key range was specified.");
+
+        // Leases are declared first, so that the transactions end before the readers are returned.
+        std::vector<ConnectionLease> leases = { };
+        std::vector<Transaction> transactions = { };
+
+        const std::optional<ParallelQueryPartition> range = this->Begin(leases, transactions);
+        if (!range.has_value()) return initial;
+
+        const std::vector<ParallelQueryPartition> partitions = Split(range->Lower, range->Upper, leases.size());
+        std::vector<std::optional<T>> results = std::vector<std::optional<T>>(partitions.size());
+        std::vector<std::exception_ptr> errors = std::vector<std::exception_ptr>(partitions.size());
+
+        const auto work = [&] (const std::size_t i) {
+            try {
+                CachedStatement s = leases[i]->Cached(this->m_sql);
+                s->Bind<1>(partitions[i].Lower);
+                s->Bind<2>(partitions[i].Upper);
+                results[i].emplace(map(*s));
+            }
+            catch (...) {
+                errors[i] = std::current_exception();
+            }
+        };
+
+        std::vector<std::thread> workers = { };
+        workers.reserve(partitions.size() - 1);
+
+        try {
+            for (std::size_t i = 1; i < partitions.size(); ++i)
+                workers.emplace_back(work, i);
+        }
+        catch (...) {
+            for (std::thread& worker : workers) worker.join();
+            throw;
+        }
+
+        // The calling thread runs the first partition.
+        work(0);
+
+        for (std::thread& worker : workers) worker.join();
+
+        for (const std::exception_ptr& error : errors)
+            if (error) std::rethrow_exception(error);
+
+        for (Transaction& transaction : transactions) transaction.Commit();
+
+        T result = std::move(initial);
+        for (std::optional<T>& partial : results)
+            result = reduce(std::move(result), std::move(partial.value()));
+
+        return result;
+    }
+
+    inline std::vector<ParallelQueryPartition> ParallelQuery::Split(const std::int64_t first, const std::int64_t last, const std::size_t count) {
+
+        if (first > last)
+            throw std::invalid_argument("'first': Must not be greater than 'last'.");
+
+        if (count == 0)
+            throw std::invalid_argument("'count': Must be greater than zero.");
+
+        // The span is computed in unsigned arithmetic, so that the full int64 range does not overflow.
+        const std::uint64_t span = (static_cast<std::uint64_t>(last) - static_cast<std::uint64_t>(first));
+        const std::uint64_t size = (span / count);
+        const std::uint64_t remainder = (span % count);
+
+        std::vector<ParallelQueryPartition> partitions = { };
+        partitions.reserve(count);
+
+        std::uint64_t lower = static_cast<std::uint64_t>(first);
+
+        for (std::size_t i = 0; i < count; ++i) {
+
+            const std::uint64_t next = (lower + size + ((i < remainder) ? 1 : 0));
+            const std::uint64_t upper = ((i + 1 == count) ? static_cast<std::uint64_t>(last) : (next - 1));
+
+            partitions.push_back({ static_cast<std::int64_t>(lower), static_cast<std::int64_t>(upper) });
+            lower = next;
+
+        }
+
+        return partitions;
+    }
+
+}
+
+#endif // _VSQLITE_PARALLELQUERY_H_
\ No newline at end of file
@@ -0,0 +1,564 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#ifndef _VSQLITE_QUERYPROFILER_H_
+#define _VSQLITE_QUERYPROFILER_H_
+
+#include <Vsqlite/SQLite.h>
+#include <Vsqlite/SqliteException.h>
+
+#include <string>
+#include <string_view>
+#include <array>
+#include <vector>
+#include <unordered_map>
+#include <memory>
+#include <functional>
+#include <mutex>
+#include <chrono>
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+#include <cstdio>
+#include <cstdint>
+#include <cstddef>
+
+namespace Vsqlite {
+
+    /**
+     * QueryProfiler settings.
+     */
+    struct QueryProfilerOptions {
+
+        /**
+         * Count the rows returned by every statement. This registers a per-row trace
+         * callback and therefore has a noticeable cost on large result sets.
+         */
+        bool CountRows = false;
+
+        /**
+         * Maximum number of distinct statements measured. Runs of further statements are
+         * aggregated under QueryProfiler::OverflowSql, so that memory use and the number of
+         * exported series stay bounded.
+         */
+        std::size_t MaxStatements = 1000;
+
+        /**
+         * Called with the SQL text when a statement starts running.
+         * Exceptions thrown by the callback are ignored.
+         */
+        std::function<void(std::string_view sql)> OnStatement = nullptr;
+
+        /**
+         * Called with the SQL text and the run time when a statement finishes running.
+         * Exceptions thrown by the callback are ignored.
+         */
+        std::function<void(std::string_view sql, std::chrono::nanoseconds elapsed)> OnProfile = nullptr;
+
+    };
+
+    /**
+     * Aggregated measurements of one normalized SQL statement text.
+     */
+    struct QueryStatistics {
+
+        /**
+         * Number of latency histogram buckets.
+         * Bucket 0 counts runs shorter than 2 microseconds; bucket i counts runs that took
+         * [2^i, 2^(i+1)) microseconds. The last bucket also counts all longer runs.
+         */
+        static constexpr std::size_t HistogramBuckets = 32;
+
+        std::string Sql;
+        std::uint64_t Calls;
+        std::uint64_t Rows;
+        std::chrono::nanoseconds TotalTime;
+        std::chrono::nanoseconds MinTime;
+        std::chrono::nanoseconds MaxTime;
+        std::array<std::uint64_t, HistogramBuckets> Histogram;
+        std::uint64_t FullscanSteps;
+        std::uint64_t Sorts;
+        std::uint64_t AutoIndexes;
+        std::uint64_t VmSteps;
+
+        /**
+         * Returns the upper bound of a histogram bucket.
+         *
+         * @param bucket Bucket index.
+         * @returns A duration in microseconds.
+         */
+        static std::chrono::microseconds GetBucketUpperBound(const std::size_t bucket);
+
+    };
+
+    /**
+     * Collects per-statement latency, row and VM counters of a database connection
+     * through sqlite3_trace_v2.
+     *
+     * Statements are grouped by their normalized SQL text (see Normalize), so that statements
+     * that differ only in inlined literals share their measurements. Run time is measured with a steady clock
+     * from the first step to the reset of a statement. The profiler is created by
+     * Database::EnableProfiling; while profiling is disabled no trace callback is registered.
+     */
+    class QueryProfiler {
+
+    private:
+        struct Run {
+            std::chrono::steady_clock::time_point Start;
+            std::uint64_t Rows;
+        };
+
+        struct Hash {
+            using is_transparent = void;
+            std::size_t operator() (const std::string_view sql) const noexcept;
+        };
+
+        sqlite3* m_pDatabase;
+        QueryProfilerOptions m_options;
+        mutable std::mutex m_mutex;
+        std::unordered_map<std::string, QueryStatistics, Hash, std::equal_to<>> m_statistics;
+        std::unordered_map<sqlite3_stmt*, Run> m_running;
+
+        void Profile(sqlite3_stmt* const pStatement, std::chrono::nanoseconds elapsed);
+
+        static std::int32_t Trace(std::uint32_t type, void* pContext, void* p, void* x);
+        static void AppendEscaped(std::string& out, const std::string_view str, const bool json);
+
+    public:
+
+        /**
+         * The SQL text under which statements are aggregated once MaxStatements is reached.
+         */
+        static constexpr std::string_view OverflowSql = "(other)";
+
+        /**
+         * Constructs a new QueryProfiler object and registers its trace callback.
+         *
+         * @param pDatabase A pointer to an SQLite database.
+         * @param options Profiler settings.
+         * @exception std::invalid_argument - The 'pDatabase' parameter is nullptr.
+         * @exception SqliteException
+         */
+        QueryProfiler(sqlite3* const pDatabase, const QueryProfilerOptions& options = { });
+
+        QueryProfiler(const QueryProfiler&) = delete;
+        QueryProfiler(QueryProfiler&&) = delete;
+
+        /**
+         * Unregisters the trace callback.
+         */
+        virtual ~QueryProfiler(void);
+
+        QueryProfiler& operator= (const QueryProfiler&) = delete;
+        QueryProfiler& operator= (QueryProfiler&&) = delete;
+
+        /**
+         * Returns the collected measurements, ordered by total time, slowest first.
+         *
+         * @returns A vector of QueryStatistics.
+         */
+        std::vector<QueryStatistics> GetSnapshot(void) const;
+
+        /**
+         * Discards the collected measurements.
+         */
+        void Reset(void);
+
+        /**
+         * Serializes the collected measurements as a JSON array.
+         *
+         * @returns A JSON document.
+         */
+        std::string ToJson(void) const;
+
+        /**
+         * Serializes the collected measurements in the Prometheus text exposition format.
+         *
+         * @param prefix Metric name prefix.
+         * @returns Prometheus metrics.
+         */
+        std::string ToPrometheus(const std::string_view prefix = "vsqlite") const;
+
+        /**
+         * Normalizes an SQL text: numeric, string and blob literals are replaced with '?',
+         * comments are removed and runs of whitespace are collapsed into a single space.
+         * Identifiers and parameters are kept as they are.
+         *
+         * @param sql An SQL text.
+         * @returns The normalized text.
+         */
+        static std::string Normalize(const std::string_view sql);
+
+    };
+
+    inline std::chrono::microseconds QueryStatistics::GetBucketUpperBound(const std::size_t bucket) {
+        return std::chrono::microseconds(std::int64_t(1) << (std::min(bucket, (HistogramBuckets - 1)) + 1));
+    }
+
+    inline std::size_t QueryProfiler::Hash::operator() (const std::string_view sql) const noexcept {
+        return std::hash<std::string_view> { }(sql);
+    }
+
+    inline QueryProfiler::QueryProfiler(sqlite3* const pDatabase, const QueryProfilerOptions& options)
+        : m_pDatabase(pDatabase), m_options(options) {
+
+        if (!pDatabase)
+            throw std::invalid_argument("'pDatabase': nullptr.");
+
+        std::uint32_t mask = (SQLITE_TRACE_STMT | SQLITE_TRACE_PROFILE);
+        if (options.CountRows) mask |= SQLITE_TRACE_ROW;
+
+        if (sqlite3_trace_v2(pDatabase, mask, &QueryProfiler::Trace, this) != SQLITE_OK)
+            throw SqliteException(pDatabase);
+
+    }
+
+    inline QueryProfiler::~QueryProfiler() {
+        sqlite3_trace_v2(this->m_pDatabase, 0, nullptr, nullptr);
+    }
+
+    inline std::int32_t QueryProfiler::Trace(std::uint32_t type, void* pContext, void* p, void* x) {
+
+        QueryProfiler* const pProfiler = static_cast<QueryProfiler*>(pContext);
+        sqlite3_stmt* const pStatement = static_cast<sqlite3_stmt*>(p);
+
+        if (type == SQLITE_TRACE_ROW) {
+            const std::lock_guard<std::mutex> lock(pProfiler->m_mutex);
+            ++pProfiler->m_running[pStatement].Rows;
+        }
+        else if (type == SQLITE_TRACE_PROFILE) {
+            pProfiler->Profile(pStatement, std::chrono::nanoseconds(*static_cast<const sqlite3_int64*>(x)));
+        }
+        else if (type == SQLITE_TRACE_STMT) {
+
+            // Trigger programs report "-- TRIGGER name" for the statement that is already running.
+            const std::string_view text = static_cast<const char*>(x);
+            if (text.starts_with("--")) return 0;
+
+            {
+                const std::lock_guard<std::mutex> lock(pProfiler->m_mutex);
+                pProfiler->m_running[pStatement] = { std::chrono::steady_clock::now(), 0 };
+            }
+
+            if (pProfiler->m_options.OnStatement) {
+                const char* const sql = sqlite3_sql(pStatement);
+                try {
+                    pProfiler->m_options.OnStatement(sql ? sql : "");
+                }
+                catch (...) { }
+            }
+
+        }
+
+        return 0;
+    }
+
+    inline void QueryProfiler::Profile(sqlite3_stmt* const pStatement, std::chrono::nanoseconds elapsed) {
+
+        const auto end = std::chrono::steady_clock::now();
+
+        const char* const text = sqlite3_sql(pStatement);
+        const std::string_view sql = (text ? text : "");
+        const std::string normalized = Normalize(sql);
+
+        const std::uint64_t fullscanSteps = sqlite3_stmt_status(pStatement, SQLITE_STMTSTATUS_FULLSCAN_STEP, 1);
+        const std::uint64_t sorts = sqlite3_stmt_status(pStatement, SQLITE_STMTSTATUS_SORT, 1);
+        const std::uint64_t autoIndexes = sqlite3_stmt_status(pStatement, SQLITE_STMTSTATUS_AUTOINDEX, 1);
+        const std::uint64_t vmSteps = sqlite3_stmt_status(pStatement, SQLITE_STMTSTATUS_VM_STEP, 1);
+
+        {
+            const std::lock_guard<std::mutex> lock(this->m_mutex);
+
+            std::uint64_t rows = 0;
+            const auto run = this->m_running.find(pStatement);
+            if (run != this->m_running.end()) {
+                elapsed = (end - run->second.Start);
+                rows = run->second.Rows;
+                this->m_running.erase(run);
+            }
+
+            const std::uint64_t us = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+            const std::size_t bucket = std::min<std::size_t>((us < 2) ? 0 : (std::bit_width(us) - 1), (QueryStatistics::HistogramBuckets - 1));
+
+            auto it = this->m_statistics.find(normalized);
+            if ((it == this->m_statistics.end()) && (this->m_statistics.size() >= this->m_options.MaxStatements))
+                it = this->m_statistics.find(OverflowSql);
+
+            if (it == this->m_statistics.end()) {
+                QueryStatistics stats = { };
+                stats.Sql = ((this->m_statistics.size() >= this->m_options.MaxStatements) ? std::string(OverflowSql) : normalized);
+                stats.MinTime = std::chrono::nanoseconds::max();
+                it = this->m_statistics.emplace(stats.Sql, std::move(stats)).first;
+            }
+
+            QueryStatistics& stats = it->second;
+            ++stats.Calls;
+            stats.TotalTime += elapsed;
+            stats.MinTime = std::min(stats.MinTime, elapsed);
+            stats.MaxTime = std::max(stats.MaxTime, elapsed);
+            ++stats.Histogram[bucket];
+            stats.FullscanSteps += fullscanSteps;
+            stats.Sorts += sorts;
+            stats.AutoIndexes += autoIndexes;
+            stats.VmSteps += vmSteps;
+            stats.Rows += rows;
+        }
+
+        if (this->m_options.OnProfile) {
+            try {
+                this->m_options.OnProfile(sql, elapsed);
+            }
+            catch (...) { }
+        }
+
+    }
+
+    inline std::vector<QueryStatistics> QueryProfiler::GetSnapshot() const {
+
+        std::vector<QueryStatistics> snapshot = { };
+
+        {
+            const std::lock_guard<std::mutex> lock(this->m_mutex);
+            snapshot.reserve(this->m_statistics.size());
+            for (const auto& [sql, stats] : this->m_statistics) snapshot.push_back(stats);
+        }
+
+        std::sort(snapshot.begin(), snapshot.end(), [] (const QueryStatistics& lhs, const QueryStatistics& rhs) {
+            return (lhs.TotalTime > rhs.TotalTime);
+        });
+
+        return snapshot;
+    }
+
+    inline void QueryProfiler::Reset() {
+        const std::lock_guard<std::mutex> lock(this->m_mutex);
+        this->m_statistics.clear();
+        this->m_running.clear();
+    }
+
+    inline std::string QueryProfiler::Normalize(const std::string_view sql) {
+
+        const auto isIdentifier = [] (const char ch) {
+            return ((ch >= 'a') && (ch <= 'z')) || ((ch >= 'A') && (ch <= 'Z')) || ((ch >= '0') && (ch <= '9'))
+                || (ch == '_') || (ch == '$') || (static_cast<unsigned char>(ch) >= 0x80);
+        };
+
+        const auto isDigit = [] (const char ch) {
+            return ((ch >= '0') && (ch <= '9'));
+        };
+
+        std::string out = { };
+        out.reserve(sql.size());
+
+        bool space = false;
+        std::size_t i = 0;
+
+        const auto append = [&out, &space] (const std::string_view token) {
+            if (space && !out.empty()) out += ' ';
+            space = false;
+            out += token;
+        };
+
+        // Copies a quoted string or identifier, with doubled closing quotes as escapes.
+        const auto quoted = [&sql, &i] (const char close) {
+            const std::size_t begin = i++;
+            while (i < sql.size()) {
+                if (sql[i++] != close) continue;
+                if ((i < sql.size()) && (sql[i] == close)) ++i;
+                else break;
+            }
+            return sql.substr(begin, (i - begin));
+        };
+
+        while (i < sql.size()) {
+
+            const char ch = sql[i];
+            const char next = (((i + 1) < sql.size()) ? sql[i + 1] : '\0');
+
+            if ((ch == ' ') || (ch == '\t') || (ch == '\n') || (ch == '\r') || (ch == '\f') || (ch == '\v')) {
+                space = true;
+                ++i;
+            }
+            else if ((ch == '-') && (next == '-')) {
+                while ((i < sql.size()) && (sql[i] != '\n')) ++i;
+                space = true;
+            }
+            else if ((ch == '/') && (next == '*')) {
+                const std::size_t end = sql.find("*/", (i + 2));
+                i = ((end == std::string_view::npos) ? sql.size() : (end + 2));
+                space = true;
+            }
+            else if (ch == '\'') {
+                static_cast<void>(quoted('\''));
+                append("?");
+            }
+            else if (((ch == 'x') || (ch == 'X')) && (next == '\'')) {
+                ++i;
+                static_cast<void>(quoted('\''));
+                append("?");
+            }
+            else if ((ch == '"') || (ch == '`')) append(quoted(ch));
+            else if (ch == '[') {
+                const std::size_t end = sql.find(']', i);
+                const std::size_t length = ((end == std::string_view::npos) ? (sql.size() - i) : (end + 1 - i));
+                append(sql.substr(i, length));
+                i += length;
+            }
+            else if ((ch == '?') || (ch == ':') || (ch == '@') || (ch == '$')) {
+                // Parameters, including their names and numbers.
+                const std::size_t begin = i++;
+                while ((i < sql.size()) && isIdentifier(sql[i])) ++i;
+                append(sql.substr(begin, (i - begin)));
+            }
+            else if (isDigit(ch) || ((ch == '.') && isDigit(next))) {
+                // Integers, reals with exponents and hexadecimal integers.
+                while ((i < sql.size()) && (isIdentifier(sql[i]) || (sql[i] == '.'))) {
+                    const char current = sql[i++];
+                    if (((current == 'e') || (current == 'E')) && (i < sql.size()) && ((sql[i] == '+') || (sql[i] == '-'))) ++i;
+                }
+                append("?");
+            }
+            else if (isIdentifier(ch)) {
+                const std::size_t begin = i;
+                while ((i < sql.size()) && isIdentifier(sql[i])) ++i;
+                append(sql.substr(begin, (i - begin)));
+            }
+            else {
+                append(sql.substr(i, 1));
+                ++i;
+            }
+
+        }
+
+        return out;
+    }
+
+    inline void QueryProfiler::AppendEscaped(std::string& out, const std::string_view str, const bool json) {
+
+        for (const char ch : str) {
+
+            if (ch == '"') out += "\\\"";
+            else if (ch == '\\') out += "\\\\";
+            else if (ch == '\n') out += "\\n";
+            else if (json && (ch == '\r')) out += "\\r";
+            else if (json && (ch == '\t')) out += "\\t";
+            else if (json && (static_cast<unsigned char>(ch) < 0x20)) {
+                char buffer[8] = { };
+                std::snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned int>(ch));
+                out += buffer;
+            }
+            else out += ch;
+
+        }
+
+    }
+
+    inline std::string QueryProfiler::ToJson() const {
+
+        const std::vector<QueryStatistics> snapshot = this->GetSnapshot();
+        std::string json = "[";
+
+        for (std::size_t i = 0; i < snapshot.size(); ++i) {
+
+            const QueryStatistics& stats = snapshot[i];
+            if (i != 0) json += ",";
+
+            json += "{\"sql\":\"";
+            AppendEscaped(json, stats.Sql, true);
+            json += "\",\"calls\":" + std::to_string(stats.Calls);
+            json += ",\"rows\":" + std::to_string(stats.Rows);
+            json += ",\"total_ns\":" + std::to_string(stats.TotalTime.count());
+            json += ",\"min_ns\":" + std::to_string(stats.MinTime.count());
+            json += ",\"max_ns\":" + std::to_string(stats.MaxTime.count());
+            json += ",\"fullscan_steps\":" + std::to_string(stats.FullscanSteps);
+            json += ",\"sorts\":" + std::to_string(stats.Sorts);
+            json += ",\"autoindexes\":" + std::to_string(stats.AutoIndexes);
+            json += ",\"vm_steps\":" + std::to_string(stats.VmSteps);
+            json += ",\"histogram_us\":[";
+
+            for (std::size_t b = 0; b < QueryStatistics::HistogramBuckets; ++b) {
+                if (b != 0) json += ",";
+                json += std::to_string(stats.Histogram[b]);
+            }
+
+            json += "]}";
+
+        }
+
+        json += "]";
+
+        return json;
+    }
+
+    inline std::string QueryProfiler::ToPrometheus(const std::string_view prefix) const {
+
+        const std::vector<QueryStatistics> snapshot = this->GetSnapshot();
+        const std::string name = std::string(prefix);
+        std::string out = { };
+
+        const auto label = [] (const QueryStatistics& stats) {
+            std::string str = "sql=\"";
+            AppendEscaped(str, stats.Sql, false);
+            str += "\"";
+            return str;
+        };
+
+        out += "# TYPE " + name + "_query_duration_seconds histogram\n";
+        for (const QueryStatistics& stats : snapshot) {
+
+            const std::string sql = label(stats);
+            std::uint64_t cumulative = 0;
+
+            for (std::size_t b = 0; b < (QueryStatistics::HistogramBuckets - 1); ++b) {
+                cumulative += stats.Histogram[b];
+                char le[32] = { };
+                std::snprintf(le, sizeof(le), "%g", (QueryStatistics::GetBucketUpperBound(b).count() / 1e6));
+                out += name + "_query_duration_seconds_bucket{" + sql + ",le=\"" + le + "\"} " + std::to_string(cumulative) + "\n";
+            }
+
+            out += name + "_query_duration_seconds_bucket{" + sql + ",le=\"+Inf\"} " + std::to_string(stats.Calls) + "\n";
+
+            char sum[32] = { };
+            std::snprintf(sum, sizeof(sum), "%.9f", (stats.TotalTime.count() / 1e9));
+            out += name + "_query_duration_seconds_sum{" + sql + "} " + sum + "\n";
+            out += name + "_query_duration_seconds_count{" + sql + "} " + std::to_string(stats.Calls) + "\n";
+
+        }
+
+        const auto counter = [&] (const std::string_view metric, std::uint64_t QueryStatistics::* pField) {
+            out += "# TYPE " + name + "_" + std::string(metric) + " counter\n";
+            for (const QueryStatistics& stats : snapshot)
+                out += name + "_" + std::string(metric) + "{" + label(stats) + "} " + std::to_string(stats.*pField) + "\n";
+        };
+
+        counter("query_rows_total", &QueryStatistics::Rows);
+        counter("query_fullscan_steps_total", &QueryStatistics::FullscanSteps);
+        counter("query_sorts_total", &QueryStatistics::Sorts);
+        counter("query_autoindexes_total", &QueryStatistics::AutoIndexes);
+        counter("query_vm_steps_total", &QueryStatistics::VmSteps);
+
+        return out;
+    }
+
+}
+
+#include <Vsqlite/Database.h>
+
+namespace Vsqlite {
+
+    inline QueryProfiler& Database::EnableProfiling(const QueryProfilerOptions& options) {
+        this->m_pProfiler.reset();
+        this->m_pProfiler = std::make_shared<QueryProfiler>(this->m_pDatabase, options);
+        return *this->m_pProfiler;
+    }
+
+    inline QueryProfiler& Database::EnableProfiling() {
+        return this->EnableProfiling(QueryProfilerOptions { });
+    }
+
+}
+
+#endif // _VSQLITE_QUERYPROFILER_H_
\ No newline at end of file
@@ -0,0 +1,81 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#ifndef _VSQLITE_ROWMAPPING_H_
+#define _VSQLITE_ROWMAPPING_H_
+
+#include <array>
+#include <tuple>
+#include <string_view>
+#include <type_traits>
+#include <cstddef>
+
+namespace Vsqlite {
+
+    /**
+     * Maps the members of a struct to statement parameters and result columns.
+     *
+     * Specializations are generated by the VSQLITE_MAP macro and provide:
+     * - Fields: a std::tuple of pointers to the mapped members, in column order.
+     * - Names: a std::array of the member names, in column order.
+     *
+     * @tparam T A struct type.
+     */
+    template <typename T>
+    struct RowMapping;
+
+    template <typename T>
+    concept IsMapped = requires {
+        RowMapping<std::remove_cv_t<T>>::Fields;
+        RowMapping<std::remove_cv_t<T>>::Names;
+    };
+
+    /**
+     * The number of statement parameters (or result columns) a value of type T occupies.
+     *
+     * @tparam T
+     */
+    template <typename T>
+    inline constexpr std::size_t ParameterCount = 1;
+
+    template <typename T>
+    requires IsMapped<T>
+    inline constexpr std::size_t ParameterCount<T> = std::tuple_size_v<std::remove_cv_t<decltype(RowMapping<std::remove_cv_t<T>>::Fields)>>;
+
+}
+
+#define VSQLITE_MAP_PARENS ()
+
+#define VSQLITE_MAP_EXPAND(...) VSQLITE_MAP_EXPAND3(VSQLITE_MAP_EXPAND3(VSQLITE_MAP_EXPAND3(VSQLITE_MAP_EXPAND3(__VA_ARGS__))))
+#define VSQLITE_MAP_EXPAND3(...) VSQLITE_MAP_EXPAND2(VSQLITE_MAP_EXPAND2(VSQLITE_MAP_EXPAND2(VSQLITE_MAP_EXPAND2(__VA_ARGS__))))
+#define VSQLITE_MAP_EXPAND2(...) VSQLITE_MAP_EXPAND1(VSQLITE_MAP_EXPAND1(VSQLITE_MAP_EXPAND1(VSQLITE_MAP_EXPAND1(__VA_ARGS__))))
+#define VSQLITE_MAP_EXPAND1(...) __VA_ARGS__
+
+#define VSQLITE_MAP_FOR_EACH(macro, type, ...) __VA_OPT__(VSQLITE_MAP_EXPAND(VSQLITE_MAP_FOR_EACH_HELPER(macro, type, __VA_ARGS__)))
+#define VSQLITE_MAP_FOR_EACH_HELPER(macro, type, field, ...) macro(type, field) __VA_OPT__(, VSQLITE_MAP_FOR_EACH_AGAIN VSQLITE_MAP_PARENS (macro, type, __VA_ARGS__))
+#define VSQLITE_MAP_FOR_EACH_AGAIN() VSQLITE_MAP_FOR_EACH_HELPER
+
+#define VSQLITE_MAP_FIELD(type, field) &type::field
+#define VSQLITE_MAP_NAME(type, field) std::string_view(#field)
+
+/**
+ * Maps the members of a struct to statement parameters and result columns, in the given order.
+ * Must be used in the global namespace, with a fully qualified type name.
+ *
+ * Example: VSQLITE_MAP(Customer, Id, FirstName, LastName, Email)
+ *
+ * MSVC requires the conforming preprocessor (/Zc:preprocessor).
+ */
+#define VSQLITE_MAP(type, ...)                                                                                          \
+    namespace Vsqlite {                                                                                                 \
+        template <>                                                                                                     \
+        struct RowMapping<type> {                                                                                       \
+            static constexpr auto Fields = std::make_tuple(VSQLITE_MAP_FOR_EACH(VSQLITE_MAP_FIELD, type, __VA_ARGS__)); \
+            static constexpr std::array Names = { VSQLITE_MAP_FOR_EACH(VSQLITE_MAP_NAME, type, __VA_ARGS__) };          \
+        };                                                                                                              \
+    }
+
+#endif // _VSQLITE_ROWMAPPING_H_
\ No newline at end of file
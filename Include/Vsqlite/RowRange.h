@@ -0,0 +1,162 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#ifndef _VSQLITE_ROWRANGE_H_
+#define _VSQLITE_ROWRANGE_H_
+
+#include <Vsqlite/Statement.h>
+#include <Vsqlite/RowMapping.h>
+
+#include <tuple>
+#include <ranges>
+#include <iterator>
+#include <utility>
+#include <cstddef>
+
+namespace Vsqlite {
+
+    template <typename... Ts>
+    struct RowValue {
+        using Type = std::tuple<Ts...>;
+    };
+
+    template <typename T>
+    requires IsMapped<T>
+    struct RowValue<T> {
+        using Type = T;
+    };
+
+    /**
+     * Represents the remaining rows of an SQLite result set as an input range.
+     *
+     * Every row is read into the same value storage, so iterating does not allocate.
+     * A row is only fetched when it is dereferenced or compared against the end of the range,
+     * which lets adaptors such as std::views::take stop without stepping past the last row they need.
+     *
+     * @tparam Ts... Column types, or a single struct type mapped with VSQLITE_MAP.
+     */
+    template <typename... Ts>
+    class RowRange : public std::ranges::view_interface<RowRange<Ts...>> {
+
+    public:
+        using value_type = typename RowValue<Ts...>::Type;
+
+        class Iterator {
+
+        private:
+            RowRange* m_pRange;
+
+            bool IsEnd(void) const {
+                this->m_pRange->Load();
+                return this->m_pRange->m_done;
+            }
+
+        public:
+            using iterator_concept = std::input_iterator_tag;
+            using value_type = RowRange::value_type;
+            using difference_type = std::ptrdiff_t;
+
+            Iterator(void) : m_pRange(nullptr) { }
+            explicit Iterator(RowRange* const pRange) : m_pRange(pRange) { }
+
+            const value_type& operator* (void) const {
+                this->m_pRange->Load();
+                return this->m_pRange->m_values;
+            }
+
+            Iterator& operator++ (void) {
+                this->m_pRange->Load();
+                this->m_pRange->m_pending = true;
+                return static_cast<Iterator&>(*this);
+            }
+
+            void operator++ (int) {
+                this->operator++ ();
+            }
+
+            friend bool operator== (const Iterator& it, std::default_sentinel_t) {
+                return it.IsEnd();
+            }
+
+        };
+
+    private:
+        Statement* m_pStatement;
+        value_type m_values;
+        bool m_pending;
+        bool m_done;
+
+        void Load(void);
+
+        template <std::size_t... Is>
+        void Read(std::index_sequence<Is...>);
+
+    public:
+
+        /**
+         * Constructs a new RowRange object.
+         *
+         * @param statement An SQLite statement. The statement must outlive the range.
+         */
+        explicit RowRange(Statement& statement);
+
+        /**
+         * Returns an iterator to the next row.
+         *
+         * @returns An Iterator.
+         */
+        Iterator begin(void);
+
+        /**
+         * Returns the end of the result set.
+         *
+         * @returns std::default_sentinel.
+         */
+        std::default_sentinel_t end(void) const;
+
+    };
+
+    template <typename... Ts>
+    inline RowRange<Ts...>::RowRange(Statement& statement)
+        : m_pStatement(&statement), m_values(), m_pending(true), m_done(false) { }
+
+    template <typename... Ts>
+    inline void RowRange<Ts...>::Load() {
+
+        if (!this->m_pending) return;
+        this->m_pending = false;
+
+        if (!this->m_pStatement->Fetch()) this->m_done = true;
+        else if constexpr (IsMapped<value_type>) this->m_pStatement->Column(this->m_values);
+        else this->Read(std::index_sequence_for<Ts...> { });
+
+    }
+
+    template <typename... Ts>
+    template <std::size_t... Is>
+    inline void RowRange<Ts...>::Read(std::index_sequence<Is...>) {
+        // The variadic Column advances past every column of a mapped struct.
+        this->m_pStatement->Column(std::get<Is>(this->m_values)...);
+    }
+
+    template <typename... Ts>
+    inline typename RowRange<Ts...>::Iterator RowRange<Ts...>::begin() {
+        return Iterator(this);
+    }
+
+    template <typename... Ts>
+    inline std::default_sentinel_t RowRange<Ts...>::end() const {
+        return std::default_sentinel;
+    }
+
+    template <typename... Ts>
+    inline RowRange<Ts...> Statement::Rows() {
+        return RowRange<Ts...>(static_cast<Statement&>(*this));
+    }
+
+}
+
+#endif // _VSQLITE_ROWRANGE_H_
\ No newline at end of file
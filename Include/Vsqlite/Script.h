@@ -0,0 +1,194 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#ifndef _VSQLITE_SCRIPT_H_
+#define _VSQLITE_SCRIPT_H_
+
+#include <Vsqlite/SQLite.h>
+#include <Vsqlite/SqliteException.h>
+#include <Vsqlite/Database.h>
+#include <Vsqlite/Statement.h>
+#include <Vsqlite/Transaction.h>
+
+#include <string_view>
+#include <vector>
+#include <optional>
+#include <chrono>
+#include <algorithm>
+#include <stdexcept>
+#include <cstdint>
+#include <cstddef>
+
+namespace Vsqlite {
+
+    /**
+     * Controls how Database::ExecuteScript runs a script.
+     */
+    struct ScriptOptions {
+
+        /**
+         * Run the whole script in one transaction, or in a savepoint if the database
+         * is already inside a transaction, and roll it back if any statement fails.
+         * The script must then not contain BEGIN, COMMIT or other statements that
+         * cannot run inside a transaction.
+         */
+        bool Atomic = true;
+
+        /**
+         * Locking mode of the transaction started when Atomic is set.
+         */
+        TransactionMode Mode = TransactionMode::Immediate;
+
+        /**
+         * How BEGIN and COMMIT are retried if the database is busy.
+         */
+        RetryPolicy Retry = { };
+
+        /**
+         * Record a ScriptStatementTiming for every statement.
+         */
+        bool Timings = false;
+
+        /**
+         * Prepare flags. The full list of flags can be found at: https://www.sqlite.org/c3ref/c_prepare_persistent.html
+         */
+        std::int32_t PrepareFlags = 0;
+
+    };
+
+    /**
+     * Measurements of a single statement of a script.
+     */
+    struct ScriptStatementTiming {
+
+        /**
+         * The statement text, including any comments before it, without surrounding whitespace
+         * or the semicolons of preceding empty statements.
+         * Points into the script.
+         */
+        std::string_view Sql;
+
+        /**
+         * Time spent preparing and running the statement.
+         */
+        std::chrono::nanoseconds Elapsed;
+
+        /**
+         * Number of rows inserted, updated or deleted by the statement, including by triggers.
+         */
+        std::int64_t Changes;
+
+    };
+
+    /**
+     * Database::ExecuteScript results.
+     */
+    struct ScriptResult {
+
+        std::size_t Statements;
+        std::int64_t Changes;
+
+        /**
+         * Time from the start of the script to the end of its commit.
+         */
+        std::chrono::nanoseconds Elapsed;
+
+        /**
+         * Per-statement measurements, in script order. Only filled in when Timings is set.
+         */
+        std::vector<ScriptStatementTiming> Timings;
+
+    };
+
+    inline ScriptResult Database::ExecuteScript(const std::string_view sql, const ScriptOptions& options) {
+
+        if (sql.empty())
+            throw std::invalid_argument("'sql': Empty string.");
+
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        ScriptResult result = { };
+
+        std::optional<Transaction> transaction = std::nullopt;
+        std::optional<Savepoint> savepoint = std::nullopt;
+
+        if (options.Atomic) {
+            if (sqlite3_get_autocommit(this->m_pDatabase)) transaction.emplace(static_cast<Database&>(*this), options.Mode, options.Retry);
+            else savepoint.emplace(static_cast<Database&>(*this), "vsqlite_script");
+        }
+
+        const char* pCurrent = sql.data();
+        const char* const pEnd = (sql.data() + sql.length());
+
+        while (pCurrent < pEnd) {
+
+            const std::chrono::steady_clock::time_point statementStart = std::chrono::steady_clock::now();
+            const std::int64_t changesBefore = sqlite3_total_changes64(this->m_pDatabase);
+
+            sqlite3_stmt* pStatement = nullptr;
+            const char* pTail = nullptr;
+
+            std::int32_t res = sqlite3_prepare_v3(
+                this->m_pDatabase,
+                pCurrent,
+                static_cast<std::int32_t>(pEnd - pCurrent),
+                options.PrepareFlags,
+                &pStatement,
+                &pTail
+            );
+
+            if (res != SQLITE_OK) {
+                const SqliteException ex = { this->m_pDatabase };
+                sqlite3_finalize(pStatement);
+                throw ex;
+            }
+
+            // Whitespace and comments compile to no statement.
+            if (!pStatement) {
+                pCurrent = pTail;
+                continue;
+            }
+
+            const Statement statement = Statement(pStatement);
+
+            do res = sqlite3_step(pStatement);
+            while (res == SQLITE_ROW);
+
+            if (res != SQLITE_DONE) throw SqliteException(pStatement);
+
+            const std::int64_t changes = (sqlite3_total_changes64(this->m_pDatabase) - changesBefore);
+            ++result.Statements;
+            result.Changes += changes;
+
+            if (options.Timings) {
+
+                // The parser skips empty statements, so their semicolons can precede the text.
+                std::string_view text = { pCurrent, static_cast<std::size_t>(pTail - pCurrent) };
+                text.remove_prefix(std::min(text.find_first_not_of(" \t\r\n\f\v;"), text.length()));
+                text.remove_suffix(text.length() - (text.find_last_not_of(" \t\r\n\f\v") + 1));
+
+                result.Timings.push_back({ text, (std::chrono::steady_clock::now() - statementStart), changes });
+
+            }
+
+            pCurrent = pTail;
+
+        }
+
+        if (transaction.has_value()) transaction->Commit();
+        else if (savepoint.has_value()) savepoint->Release();
+
+        result.Elapsed = (std::chrono::steady_clock::now() - start);
+
+        return result;
+    }
+
+    inline ScriptResult Database::ExecuteScript(const std::string_view sql) {
+        return this->ExecuteScript(sql, ScriptOptions { });
+    }
+
+}
+
+#endif // _VSQLITE_SCRIPT_H_
\ No newline at end of file
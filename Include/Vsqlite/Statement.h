@@ -9,15 +9,33 @@
 
 #include <Vsqlite/SQLite.h>
 #include <Vsqlite/DataBinding.h>
+#include <Vsqlite/RowMapping.h>
 #include <Vsqlite/SqliteException.h>
 
 #include <string_view>
+#include <span>
+#include <vector>
+#include <optional>
+#include <algorithm>
+#include <utility>
 #include <cstdint>
+#include <cstddef>
 
 namespace Vsqlite {
 
     class Database;
 
+    template <typename... Ts>
+    class RowRange;
+
+    template <typename... Ts>
+    class ColumnBuffers;
+
+    class Executor;
+
+    template <typename T>
+    class AsyncOperation;
+
     /**
      * Represents an SQLite statement.
      */
@@ -26,6 +44,24 @@ namespace Vsqlite {
     private:
         sqlite3_stmt* m_pStatement;
         bool m_canFetch;
+        bool m_done;
+        std::vector<std::vector<std::byte>> m_columnViews;
+
+        template <typename T>
+        void DetachColumnView(T& arg);
+
+        template <typename T>
+        void DetachColumnView(std::optional<T>& arg);
+
+        void DetachColumnView(std::string_view& arg);
+        void DetachColumnView(std::span<const std::byte>& arg);
+        void ReleaseColumnViews(void);
+
+        template <std::int32_t Index, typename T, std::size_t... Is>
+        void BindFields(const T& obj, std::index_sequence<Is...>);
+
+        template <std::int32_t Column, typename T, std::size_t... Is>
+        void ColumnFields(T& obj, std::index_sequence<Is...>);
 
     public:
 
@@ -51,6 +87,14 @@ namespace Vsqlite {
          */
         Statement(sqlite3* const pDatabase, const std::string_view sql, const std::int32_t flags);
 
+        /**
+         * Constructs a new Statement object that takes ownership of a prepared statement.
+         * 
+         * @param pStatement An SQLite statement handle. It is finalized when the Statement is destroyed.
+         * @exception std::invalid_argument - The 'pStatement' parameter is nullptr.
+         */
+        explicit Statement(sqlite3_stmt* const pStatement);
+
         Statement(const Statement&) = delete;
         Statement(Statement&& statement) noexcept;
         virtual ~Statement(void);
@@ -86,6 +130,18 @@ namespace Vsqlite {
          */
         void Execute(void);
 
+        /**
+         * Evaluates the statement on an executor.
+         * 
+         * The statement must not be used by anything else until the operation completes.
+         * Defined in <Vsqlite/Async.h>.
+         * 
+         * @param resume The executor that resumes the awaiting coroutine, such as the caller's event loop.
+         * @returns An awaitable that yields true if a row is available; otherwise, false.
+         * The awaitable throws SqliteException if the evaluation fails.
+         */
+        [[nodiscard]] AsyncOperation<bool> StepAsync(Executor& resume);
+
         /**
          * 
          * 
@@ -99,7 +155,8 @@ namespace Vsqlite {
         void Bind(const T& arg);
 
         /**
-         * 
+         * Binds a value to parameter 1. The mapped members of a struct mapped with
+         * VSQLITE_MAP are bound to parameters 1 to N, in mapping order.
          * 
          * @tparam T
          * @param arg
@@ -161,7 +218,8 @@ namespace Vsqlite {
         void Column(T& arg);
 
         /**
-         * 
+         * Reads column 0 of the current row. A struct mapped with VSQLITE_MAP reads
+         * columns 0 to N-1 into its mapped members, in mapping order.
          * 
          * @tparam T
          * @param arg
@@ -201,6 +259,12 @@ namespace Vsqlite {
         /**
          * Retrieves values from the current row of an SQLite result set.
          * 
+         * std::string_view and std::span<const std::byte> values point into the row buffer
+         * and are valid until the next Step or Reset. When VSQLITE_DEBUG_COLUMN_VIEWS is defined
+         * (opt-in, in every translation unit), such values point into statement-owned copies instead,
+         * which are poisoned and freed on the next Step or Reset so that stale views are caught.
+         * A struct mapped with VSQLITE_MAP reads one column per mapped member, in mapping order.
+         * 
          * @tparam Args...
          * @param args
          * @returns true if Fetch can retrieve more data; otherwise, false.
@@ -210,6 +274,45 @@ namespace Vsqlite {
         template <typename... Args>
         bool Fetch(Args&... args);
 
+        /**
+         * Retrieves the current row of an SQLite result set into a struct.
+         * 
+         * @tparam T A struct type mapped with VSQLITE_MAP.
+         * @returns The row, or std::nullopt if there are no more rows.
+         * @exception std::invalid_argument
+         * @exception SqliteException
+         */
+        template <typename T>
+        requires IsMapped<T>
+        std::optional<T> FetchInto(void);
+
+        /**
+         * Returns the remaining rows of the result set as an input range of std::tuple<Ts...>,
+         * or of T if the only column type is a struct mapped with VSQLITE_MAP.
+         * 
+         * The row value is reused for every row. Views into the row buffer follow the same rules as Fetch.
+         * 
+         * @tparam Ts... Column types.
+         * @returns A RowRange.
+         */
+        template <typename... Ts>
+        RowRange<Ts...> Rows(void);
+
+        /**
+         * Retrieves up to 'count' rows of an SQLite result set into per-column arrays.
+         * The buffers are cleared first; their capacity is reused.
+         * 
+         * @tparam Ts... Column types.
+         * @param count Maximum number of rows to retrieve.
+         * @param buffers Column buffers that receive the rows.
+         * @returns The number of rows retrieved. Less than 'count' if the result set is exhausted;
+         * once it is, every further call returns 0 until the statement is reset.
+         * @exception std::invalid_argument
+         * @exception SqliteException
+         */
+        template <typename... Ts>
+        std::size_t FetchBatch(const std::size_t count, ColumnBuffers<Ts...>& buffers);
+
         /**
          * Executes the statement.
          * 
@@ -221,6 +324,28 @@ namespace Vsqlite {
         template <typename... Args>
         void Execute(const Args&... args);
 
+        /**
+         * Executes the statement, binding every parameter without clearing the previous bindings first.
+         * 
+         * This is faster than Execute when the statement runs in a loop, but requires
+         * the number of arguments to equal the number of statement parameters.
+         * A struct mapped with VSQLITE_MAP counts as one argument per mapped member.
+         * 
+         * @tparam Args... 
+         * @param args 
+         * @exception std::invalid_argument - The number of arguments does not match the number of parameters.
+         * @exception SqliteException
+         */
+        template <typename... Args>
+        void ExecuteRebind(const Args&... args);
+
+        /**
+         * Returns the number of parameters in the statement.
+         * 
+         * @returns An integer.
+         */
+        std::int32_t GetParameterCount(void) const;
+
     };
 
     inline Statement::Statement(sqlite3* pDatabase, const std::string_view sql, const std::int32_t flags) {
@@ -246,6 +371,14 @@ namespace Vsqlite {
         }
 
         this->m_canFetch = false;
+        this->m_done = false;
+
+    }
+
+    inline Statement::Statement(sqlite3_stmt* const pStatement) : m_pStatement(pStatement), m_canFetch(false), m_done(false) {
+
+        if (!pStatement)
+            throw std::invalid_argument("'pStatement': nullptr.");
 
     }
 
@@ -276,8 +409,11 @@ namespace Vsqlite {
 
             this->m_pStatement = statement.m_pStatement;
             this->m_canFetch = statement.m_canFetch;
+            this->m_done = statement.m_done;
+            this->m_columnViews = std::move(statement.m_columnViews);
             statement.m_pStatement = nullptr;
             statement.m_canFetch = false;
+            statement.m_done = false;
             
         }
 
@@ -288,16 +424,52 @@ namespace Vsqlite {
         return this->m_pStatement;
     }
 
+    template <typename T>
+    inline void Statement::DetachColumnView(T&) { }
+
+    template <typename T>
+    inline void Statement::DetachColumnView(std::optional<T>& arg) {
+        if (arg.has_value()) this->DetachColumnView(arg.value());
+    }
+
+    inline void Statement::DetachColumnView([[maybe_unused]] std::string_view& arg) {
+#ifdef VSQLITE_DEBUG_COLUMN_VIEWS
+        const std::byte* pData = reinterpret_cast<const std::byte*>(arg.data());
+        const std::vector<std::byte>& copy = this->m_columnViews.emplace_back(pData, (pData + arg.length()));
+        arg = { reinterpret_cast<const char*>(copy.data()), copy.size() };
+#endif
+    }
+
+    inline void Statement::DetachColumnView([[maybe_unused]] std::span<const std::byte>& arg) {
+#ifdef VSQLITE_DEBUG_COLUMN_VIEWS
+        const std::vector<std::byte>& copy = this->m_columnViews.emplace_back(arg.begin(), arg.end());
+        arg = { copy.data(), copy.size() };
+#endif
+    }
+
+    inline void Statement::ReleaseColumnViews() {
+        
+        for (std::vector<std::byte>& view : this->m_columnViews)
+            std::fill(view.begin(), view.end(), std::byte { 0xDD });
+        
+        this->m_columnViews.clear();
+
+    }
+
     inline void Statement::Reset() { 
+        this->ReleaseColumnViews();
         const std::int32_t res = sqlite3_reset(this->m_pStatement);
         if (res != SQLITE_OK) throw SqliteException(this->m_pStatement);
         this->m_canFetch = false;
+        this->m_done = false;
     }
 
     inline void Statement::Step() { 
+        this->ReleaseColumnViews();
         const std::int32_t res = sqlite3_step(this->m_pStatement);
         if ((res != SQLITE_ROW) && (res != SQLITE_DONE)) throw SqliteException(this->m_pStatement); 
         this->m_canFetch = (res == SQLITE_ROW);
+        this->m_done = (res == SQLITE_DONE);
     }
 
     inline void Statement::Execute() { 
@@ -308,8 +480,14 @@ namespace Vsqlite {
 
     template <std::int32_t Index, typename T>
     inline void Statement::Bind(const T& arg) {
-        const std::int32_t res = DataBinding<T>::Bind(this->m_pStatement, Index, arg);
-        if (res != SQLITE_OK) throw SqliteException(this->m_pStatement);
+
+        // A mapped struct occupies one parameter per mapped member, wherever it appears.
+        if constexpr (IsMapped<T>) this->BindFields<Index>(arg, std::make_index_sequence<ParameterCount<T>> { });
+        else {
+            const std::int32_t res = DataBinding<T>::Bind(this->m_pStatement, Index, arg);
+            if (res != SQLITE_OK) throw SqliteException(this->m_pStatement);
+        }
+
     }
 
     template <typename T>
@@ -319,9 +497,8 @@ namespace Vsqlite {
 
     template <std::int32_t Index, typename T, typename... Args>
     inline void Statement::Bind(const T& arg, const Args&... args) {
-        const std::int32_t res = DataBinding<T>::Bind(this->m_pStatement, Index, arg);
-        if (res != SQLITE_OK) throw SqliteException(this->m_pStatement);
-        this->Bind<Index + 1>(args...);
+        this->Bind<Index>(arg);
+        this->Bind<(Index + static_cast<std::int32_t>(ParameterCount<T>))>(args...);
     }
 
     template <typename T, typename... Args>
@@ -329,6 +506,11 @@ namespace Vsqlite {
         this->Bind<1>(arg, args...);
     }
 
+    template <std::int32_t Index, typename T, std::size_t... Is>
+    inline void Statement::BindFields(const T& obj, std::index_sequence<Is...>) {
+        (this->Bind<(Index + static_cast<std::int32_t>(Is))>(obj.*std::get<Is>(RowMapping<T>::Fields)), ...);
+    }
+
     inline void Statement::Unbind() {
         const std::int32_t res = sqlite3_clear_bindings(this->m_pStatement);
         if (res != SQLITE_OK) throw SqliteException(this->m_pStatement);
@@ -338,7 +520,14 @@ namespace Vsqlite {
 
     template <std::int32_t Column, typename T>
     inline void Statement::Column(T& arg) {
-        DataBinding<T>::Column(this->m_pStatement, Column, arg);
+
+        // A mapped struct occupies one column per mapped member, wherever it appears.
+        if constexpr (IsMapped<T>) this->ColumnFields<Column>(arg, std::make_index_sequence<ParameterCount<T>> { });
+        else {
+            DataBinding<T>::Column(this->m_pStatement, Column, arg);
+            this->DetachColumnView(arg);
+        }
+
     }
 
     template <typename T>
@@ -348,8 +537,8 @@ namespace Vsqlite {
 
     template <std::int32_t Column, typename T, typename... Args>
     inline void Statement::Column(T& arg, Args&... args) {
-        DataBinding<T>::Column(this->m_pStatement, Column, arg);
-        this->Column<Column + 1>(args...);
+        this->Column<Column>(arg);
+        this->Column<(Column + static_cast<std::int32_t>(ParameterCount<T>))>(args...);
     }
 
     template <typename T, typename... Args>
@@ -357,6 +546,11 @@ namespace Vsqlite {
         this->Column<0>(arg, args...);
     }
 
+    template <std::int32_t Column, typename T, std::size_t... Is>
+    inline void Statement::ColumnFields(T& obj, std::index_sequence<Is...>) {
+        (this->Column<(Column + static_cast<std::int32_t>(Is))>(obj.*std::get<Is>(RowMapping<T>::Fields)), ...);
+    }
+
     template <typename... Args>
     inline bool Statement::Fetch(Args&... args) {
 
@@ -371,6 +565,16 @@ namespace Vsqlite {
         return false;
     }
 
+    template <typename T>
+    requires IsMapped<T>
+    inline std::optional<T> Statement::FetchInto() {
+
+        std::optional<T> obj = std::make_optional<T>();
+        if (!this->Fetch(obj.value())) obj.reset();
+
+        return obj;
+    }
+
     template <typename... Args>
     inline void Statement::Execute(const Args&... args) {
         this->Reset();
@@ -379,9 +583,27 @@ namespace Vsqlite {
         this->Step();
     }
 
+    template <typename... Args>
+    inline void Statement::ExecuteRebind(const Args&... args) {
+        
+        if ((0 + ... + ParameterCount<Args>) != static_cast<std::size_t>(this->GetParameterCount()))
+            throw std::invalid_argument("Statement::ExecuteRebind(): Argument count does not match the parameter count.");
+
+        this->Reset();
+        if constexpr (sizeof...(Args) != 0) this->Bind(args...);
+        this->Step();
+
+    }
+
+    inline std::int32_t Statement::GetParameterCount() const {
+        return sqlite3_bind_parameter_count(this->m_pStatement);
+    }
+
 }
 
 #include <Vsqlite/Database.h>
+#include <Vsqlite/RowRange.h>
+#include <Vsqlite/ColumnBuffers.h>
 
 namespace Vsqlite {
 
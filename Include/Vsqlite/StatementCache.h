@@ -0,0 +1,291 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#ifndef _VSQLITE_STATEMENTCACHE_H_
+#define _VSQLITE_STATEMENTCACHE_H_
+
+#include <Vsqlite/SQLite.h>
+
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include <cstddef>
+#include <list>
+#include <unordered_map>
+
+namespace Vsqlite {
+
+    class Statement;
+    class StatementCache;
+
+    /**
+     * Statement cache counters.
+     */
+    struct StatementCacheStatistics {
+        std::uint64_t Hits;
+        std::uint64_t Misses;
+        std::uint64_t Evictions;
+        std::size_t Size;
+        std::size_t Capacity;
+    };
+
+    /**
+     * Represents a prepared statement leased from a StatementCache.
+     *
+     * The statement is returned to the cache when the lease is destroyed.
+     * A lease must not outlive the Database that created it.
+     */
+    class CachedStatement {
+
+    private:
+        struct Entry;
+
+        StatementCache* m_pCache;
+        std::list<Entry> m_entry;
+
+        CachedStatement(StatementCache* const pCache, std::list<Entry>&& entry);
+
+    public:
+        CachedStatement(const CachedStatement&) = delete;
+        CachedStatement(CachedStatement&& statement) noexcept;
+        virtual ~CachedStatement(void);
+
+        CachedStatement& operator= (const CachedStatement&) = delete;
+        CachedStatement& operator= (CachedStatement&& statement) noexcept;
+
+        /**
+         * Returns the leased statement.
+         *
+         * @returns A Statement.
+         */
+        Statement& GetStatement(void);
+
+        Statement& operator* (void);
+        Statement* operator-> (void);
+
+        friend class StatementCache;
+
+    };
+
+    /**
+     * Represents a bounded, least recently used cache of prepared statements keyed by SQL text.
+     */
+    class StatementCache {
+
+    private:
+        using Entry = CachedStatement::Entry;
+
+        sqlite3* m_pDatabase;
+        std::size_t m_capacity;
+        std::list<Entry> m_entries;
+        std::unordered_map<std::string_view, std::list<Entry>::iterator> m_lookup;
+        std::uint64_t m_hits;
+        std::uint64_t m_misses;
+        std::uint64_t m_evictions;
+
+        void Return(std::list<Entry>& entry) noexcept;
+        void Evict(const std::size_t capacity) noexcept;
+
+    public:
+
+        /**
+         * The default maximum number of cached statements.
+         */
+        static constexpr std::size_t DefaultCapacity = 32;
+
+        /**
+         * Constructs a new StatementCache object.
+         *
+         * @param pDatabase An SQLite database.
+         * @param capacity The maximum number of cached statements.
+         */
+        StatementCache(sqlite3* const pDatabase, const std::size_t capacity = DefaultCapacity);
+
+        StatementCache(const StatementCache&) = delete;
+        StatementCache(StatementCache&&) = delete;
+        virtual ~StatementCache(void);
+
+        StatementCache& operator= (const StatementCache&) = delete;
+        StatementCache& operator= (StatementCache&&) = delete;
+
+        /**
+         * Leases a reset prepared statement with no bound parameters.
+         * The statement is prepared only if the cache does not already contain it.
+         *
+         * @param sql An SQL statement.
+         * @returns A CachedStatement.
+         * @exception std::invalid_argument - The 'sql' parameter is an empty string.
+         * @exception SqliteException
+         */
+        [[nodiscard]] CachedStatement Acquire(const std::string_view sql);
+
+        /**
+         * Returns the maximum number of cached statements.
+         *
+         * @returns An integer.
+         */
+        std::size_t GetCapacity(void) const;
+
+        /**
+         * Sets the maximum number of cached statements.
+         * Excess statements are evicted.
+         *
+         * @param capacity The maximum number of cached statements. Zero disables caching.
+         */
+        void SetCapacity(const std::size_t capacity);
+
+        /**
+         * Returns the cache counters.
+         *
+         * @returns A StatementCacheStatistics.
+         */
+        StatementCacheStatistics GetStatistics(void) const;
+
+        /**
+         * Finalizes all cached statements. Leased statements are not affected.
+         */
+        void Clear(void);
+
+        friend class CachedStatement;
+
+    };
+
+}
+
+#include <Vsqlite/Statement.h>
+
+namespace Vsqlite {
+
+    struct CachedStatement::Entry {
+        std::string Sql;
+        Statement Value;
+    };
+
+    inline CachedStatement::CachedStatement(StatementCache* const pCache, std::list<Entry>&& entry)
+        : m_pCache(pCache), m_entry(std::move(entry)) { }
+
+    inline CachedStatement::CachedStatement(CachedStatement&& statement) noexcept {
+        this->m_pCache = nullptr;
+        this->operator= (std::move(statement));
+    }
+
+    inline CachedStatement::~CachedStatement() {
+
+        if (this->m_pCache) {
+            this->m_pCache->Return(this->m_entry);
+            this->m_pCache = nullptr;
+        }
+
+    }
+
+    inline CachedStatement& CachedStatement::operator= (CachedStatement&& statement) noexcept {
+
+        if (this != &statement) {
+
+            if (this->m_pCache) {
+                this->m_pCache->Return(this->m_entry);
+                this->m_pCache = nullptr;
+            }
+
+            this->m_pCache = statement.m_pCache;
+            this->m_entry = std::move(statement.m_entry);
+            statement.m_pCache = nullptr;
+
+        }
+
+        return static_cast<CachedStatement&>(*this);
+    }
+
+    inline Statement& CachedStatement::GetStatement() {
+        return this->m_entry.front().Value;
+    }
+
+    inline Statement& CachedStatement::operator* () {
+        return this->GetStatement();
+    }
+
+    inline Statement* CachedStatement::operator-> () {
+        return &this->GetStatement();
+    }
+
+    inline StatementCache::StatementCache(sqlite3* const pDatabase, const std::size_t capacity)
+        : m_pDatabase(pDatabase), m_capacity(capacity), m_hits(0), m_misses(0), m_evictions(0) { }
+
+    inline StatementCache::~StatementCache() {
+        this->Clear();
+    }
+
+    inline CachedStatement StatementCache::Acquire(const std::string_view sql) {
+
+        const auto it = this->m_lookup.find(sql);
+        if (it != this->m_lookup.end()) {
+
+            std::list<Entry> entry = { };
+            entry.splice(entry.begin(), this->m_entries, it->second);
+            this->m_lookup.erase(it);
+            entry.front().Value.Reset();
+            ++this->m_hits;
+
+            return CachedStatement(this, std::move(entry));
+        }
+
+        std::list<Entry> entry = { };
+        entry.emplace_back(std::string(sql), Statement(this->m_pDatabase, sql, SQLITE_PREPARE_PERSISTENT));
+        ++this->m_misses;
+
+        return CachedStatement(this, std::move(entry));
+    }
+
+    inline void StatementCache::Return(std::list<Entry>& entry) noexcept {
+
+        sqlite3_stmt* const pStatement = entry.front().Value.GetStatementHandle();
+        if (!pStatement) return;
+
+        if ((this->m_capacity == 0) || this->m_lookup.contains(entry.front().Sql)) {
+            entry.clear();
+            return;
+        }
+
+        sqlite3_reset(pStatement);
+        sqlite3_clear_bindings(pStatement);
+
+        this->m_entries.splice(this->m_entries.begin(), entry);
+        this->m_lookup.emplace(this->m_entries.front().Sql, this->m_entries.begin());
+        this->Evict(this->m_capacity);
+
+    }
+
+    inline void StatementCache::Evict(const std::size_t capacity) noexcept {
+
+        while (this->m_entries.size() > capacity) {
+            this->m_lookup.erase(this->m_entries.back().Sql);
+            this->m_entries.pop_back();
+            ++this->m_evictions;
+        }
+
+    }
+
+    inline std::size_t StatementCache::GetCapacity() const {
+        return this->m_capacity;
+    }
+
+    inline void StatementCache::SetCapacity(const std::size_t capacity) {
+        this->m_capacity = capacity;
+        this->Evict(capacity);
+    }
+
+    inline StatementCacheStatistics StatementCache::GetStatistics() const {
+        return { this->m_hits, this->m_misses, this->m_evictions, this->m_entries.size(), this->m_capacity };
+    }
+
+    inline void StatementCache::Clear() {
+        this->m_lookup.clear();
+        this->m_entries.clear();
+    }
+
+}
+
+#endif // _VSQLITE_STATEMENTCACHE_H_
\ No newline at end of file
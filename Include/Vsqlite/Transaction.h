@@ -0,0 +1,348 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#ifndef _VSQLITE_TRANSACTION_H_
+#define _VSQLITE_TRANSACTION_H_
+
+#include <Vsqlite/SQLite.h>
+#include <Vsqlite/SqliteException.h>
+#include <Vsqlite/Database.h>
+#include <Vsqlite/Statement.h>
+#include <Vsqlite/StatementCache.h>
+
+#include <string>
+#include <string_view>
+#include <chrono>
+#include <thread>
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <cstdint>
+
+namespace Vsqlite {
+
+    /**
+     * Transaction locking modes.
+     * More info: https://www.sqlite.org/lang_transaction.html
+     */
+    enum class TransactionMode : std::int32_t {
+        Deferred = 0,
+        Immediate = 1,
+        Exclusive = 2,
+    };
+
+    /**
+     * Describes how operations that fail with SQLITE_BUSY are retried.
+     */
+    struct RetryPolicy {
+
+        /**
+         * Maximum number of attempts. 1 disables retrying.
+         * The default retries an operation four times, waiting at most 15 ms in total
+         * with the default delays, on top of the connection's busy timeout.
+         */
+        std::int32_t MaxAttempts = 5;
+
+        /**
+         * Delay before the second attempt.
+         */
+        std::chrono::microseconds InitialDelay = std::chrono::milliseconds(1);
+
+        /**
+         * Upper bound of the delay between attempts.
+         */
+        std::chrono::microseconds MaxDelay = std::chrono::milliseconds(100);
+
+        /**
+         * Factor by which the delay grows after every attempt.
+         */
+        double Multiplier = 2.00;
+
+        /**
+         * Runs an operation, retrying it with exponential backoff while it throws
+         * a SqliteException with the SQLITE_BUSY error code.
+         *
+         * @tparam F
+         * @param operation The operation.
+         * @returns The result of the operation.
+         * @exception SqliteException - The last attempt failed.
+         */
+        template <typename F>
+        decltype(auto) Run(F&& operation) const;
+
+    };
+
+    /**
+     * Represents a transaction that is rolled back unless it is committed.
+     *
+     * The BEGIN, COMMIT and ROLLBACK statements are prepared once per connection
+     * through the database's statement cache.
+     */
+    class Transaction {
+
+    private:
+        Database* m_pDatabase;
+        RetryPolicy m_retryPolicy;
+        bool m_active;
+
+    public:
+
+        /**
+         * Begins a transaction.
+         *
+         * @param database An SQLite database.
+         * @param mode The locking mode.
+         * @param retryPolicy How BEGIN and COMMIT are retried if the database is busy.
+         * @exception SqliteException
+         */
+        Transaction(Database& database, const TransactionMode mode = TransactionMode::Deferred, const RetryPolicy& retryPolicy = { });
+
+        Transaction(const Transaction&) = delete;
+        Transaction(Transaction&& transaction) noexcept;
+
+        /**
+         * Rolls the transaction back if it is still active.
+         */
+        virtual ~Transaction(void);
+
+        Transaction& operator= (const Transaction&) = delete;
+        Transaction& operator= (Transaction&&) = delete;
+
+        /**
+         * Commits the transaction.
+         *
+         * @exception std::logic_error - The transaction is not active.
+         * @exception SqliteException
+         */
+        void Commit(void);
+
+        /**
+         * Rolls the transaction back.
+         *
+         * @exception std::logic_error - The transaction is not active.
+         * @exception SqliteException
+         */
+        void Rollback(void);
+
+        /**
+         * Checks whether the transaction has neither been committed nor rolled back.
+         *
+         * @returns true if the transaction is active; otherwise, false.
+         */
+        bool IsActive(void) const;
+
+    };
+
+    /**
+     * Represents a savepoint that is rolled back unless it is released.
+     * Savepoints can be nested, both inside and outside of a Transaction.
+     */
+    class Savepoint {
+
+    private:
+        Database* m_pDatabase;
+        std::string m_release;
+        std::string m_rollback;
+        bool m_active;
+
+    public:
+
+        /**
+         * The default savepoint name. Nested savepoints may share a name.
+         */
+        static constexpr std::string_view DefaultName = "vsqlite_savepoint";
+
+        /**
+         * Creates a savepoint.
+         *
+         * @param database An SQLite database.
+         * @param name The savepoint name.
+         * @exception std::invalid_argument - The 'name' parameter is an empty string.
+         * @exception SqliteException
+         */
+        Savepoint(Database& database, const std::string_view name = DefaultName);
+
+        Savepoint(const Savepoint&) = delete;
+        Savepoint(Savepoint&& savepoint) noexcept;
+
+        /**
+         * Rolls back to the savepoint and releases it, if it is still active.
+         */
+        virtual ~Savepoint(void);
+
+        Savepoint& operator= (const Savepoint&) = delete;
+        Savepoint& operator= (Savepoint&&) = delete;
+
+        /**
+         * Releases the savepoint, keeping its changes.
+         *
+         * @exception std::logic_error - The savepoint is not active.
+         * @exception SqliteException
+         */
+        void Release(void);
+
+        /**
+         * Rolls back to the savepoint and releases it.
+         *
+         * @exception std::logic_error - The savepoint is not active.
+         * @exception SqliteException
+         */
+        void Rollback(void);
+
+        /**
+         * Checks whether the savepoint has neither been released nor rolled back.
+         *
+         * @returns true if the savepoint is active; otherwise, false.
+         */
+        bool IsActive(void) const;
+
+    };
+
+    template <typename F>
+    inline decltype(auto) RetryPolicy::Run(F&& operation) const {
+
+        std::chrono::microseconds delay = this->InitialDelay;
+
+        for (std::int32_t attempt = 1; ; ++attempt) {
+
+            try {
+                return operation();
+            }
+            catch (const SqliteException& ex) {
+                if ((ex.GetErrorCode() != SQLITE_BUSY) || (attempt >= this->MaxAttempts)) throw;
+            }
+
+            std::this_thread::sleep_for(delay);
+
+            const auto next = std::chrono::duration_cast<std::chrono::microseconds>(delay * this->Multiplier);
+            delay = std::min(next, this->MaxDelay);
+
+        }
+
+    }
+
+    inline Transaction::Transaction(Database& database, const TransactionMode mode, const RetryPolicy& retryPolicy)
+        : m_pDatabase(&database), m_retryPolicy(retryPolicy), m_active(false) {
+
+        std::string_view sql = "BEGIN DEFERRED";
+        if (mode == TransactionMode::Immediate) sql = "BEGIN IMMEDIATE";
+        else if (mode == TransactionMode::Exclusive) sql = "BEGIN EXCLUSIVE";
+
+        this->m_retryPolicy.Run([this, sql] () { this->m_pDatabase->Cached(sql)->Execute(); });
+        this->m_active = true;
+
+    }
+
+    inline Transaction::Transaction(Transaction&& transaction) noexcept
+        : m_pDatabase(transaction.m_pDatabase), m_retryPolicy(transaction.m_retryPolicy), m_active(transaction.m_active) {
+        transaction.m_active = false;
+    }
+
+    inline Transaction::~Transaction() {
+
+        if (!this->m_active) return;
+
+        try {
+            this->Rollback();
+        }
+        catch (...) { }
+
+    }
+
+    inline void Transaction::Commit() {
+
+        if (!this->m_active)
+            throw std::logic_error("Transaction::Commit(): The transaction is not active.");
+
+        this->m_retryPolicy.Run([this] () { this->m_pDatabase->Cached("COMMIT")->Execute(); });
+        this->m_active = false;
+
+    }
+
+    inline void Transaction::Rollback() {
+
+        if (!this->m_active)
+            throw std::logic_error("Transaction::Rollback(): The transaction is not active.");
+
+        this->m_active = false;
+
+        if (!sqlite3_get_autocommit(this->m_pDatabase->GetDatabaseHandle()))
+            this->m_pDatabase->Cached("ROLLBACK")->Execute();
+
+    }
+
+    inline bool Transaction::IsActive() const {
+        return this->m_active;
+    }
+
+    inline Savepoint::Savepoint(Database& database, const std::string_view name) : m_pDatabase(&database), m_active(false) {
+
+        if (name.empty())
+            throw std::invalid_argument("'name': Empty string.");
+
+        std::string identifier = "\"";
+        for (const char ch : name) {
+            if (ch == '"') identifier += '"';
+            identifier += ch;
+        }
+        identifier += '"';
+
+        this->m_release = ("RELEASE " + identifier);
+        this->m_rollback = ("ROLLBACK TO " + identifier);
+
+        this->m_pDatabase->Cached("SAVEPOINT " + identifier)->Execute();
+        this->m_active = true;
+
+    }
+
+    inline Savepoint::Savepoint(Savepoint&& savepoint) noexcept
+        : m_pDatabase(savepoint.m_pDatabase), m_release(std::move(savepoint.m_release)),
+        m_rollback(std::move(savepoint.m_rollback)), m_active(savepoint.m_active) {
+        savepoint.m_active = false;
+    }
+
+    inline Savepoint::~Savepoint() {
+
+        if (!this->m_active) return;
+
+        try {
+            this->Rollback();
+        }
+        catch (...) { }
+
+    }
+
+    inline void Savepoint::Release() {
+
+        if (!this->m_active)
+            throw std::logic_error("Savepoint::Release(): The savepoint is not active.");
+
+        this->m_pDatabase->Cached(this->m_release)->Execute();
+        this->m_active = false;
+
+    }
+
+    inline void Savepoint::Rollback() {
+
+        if (!this->m_active)
+            throw std::logic_error("Savepoint::Rollback(): The savepoint is not active.");
+
+        this->m_active = false;
+
+        if (!sqlite3_get_autocommit(this->m_pDatabase->GetDatabaseHandle())) {
+            this->m_pDatabase->Cached(this->m_rollback)->Execute();
+            this->m_pDatabase->Cached(this->m_release)->Execute();
+        }
+
+    }
+
+    inline bool Savepoint::IsActive() const {
+        return this->m_active;
+    }
+
+}
+
+#endif // _VSQLITE_TRANSACTION_H_
\ No newline at end of file
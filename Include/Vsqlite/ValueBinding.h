@@ -0,0 +1,264 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#ifndef _VSQLITE_VALUEBINDING_H_
+#define _VSQLITE_VALUEBINDING_H_
+
+#include <Vsqlite/SQLite.h>
+#include <Vsqlite/DataBinding.h>
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <span>
+#include <vector>
+#include <type_traits>
+#include <typeinfo>
+#include <concepts>
+#include <optional>
+#include <stdexcept>
+
+namespace Vsqlite {
+
+    /**
+     * Converts between C++ types and sqlite3_value arguments and sqlite3_context results,
+     * the way DataBinding does for statement parameters and columns.
+     * Used by SQL functions and virtual tables.
+     */
+    template <typename T>
+    struct ValueBinding {
+
+        static inline void Value(sqlite3_value* const pValue, T& arg) {
+            using namespace std::string_literals;
+            throw std::invalid_argument("ValueBinding specialization for '"s + typeid(T).name() + "' does not exist.");
+        }
+
+        static inline void Result(sqlite3_context* const pContext, const T& arg) {
+            using namespace std::string_literals;
+            throw std::invalid_argument("ValueBinding specialization for '"s + typeid(T).name() + "' does not exist.");
+        }
+
+    };
+
+}
+
+#ifndef VSQLITE_NO_DEFAULT_VALUEBINDING_SPECIALIZATIONS
+namespace Vsqlite {
+
+    template <>
+    struct ValueBinding<std::nullptr_t> {
+
+        static inline void Result(sqlite3_context* const pContext, const std::nullptr_t&) {
+            sqlite3_result_null(pContext);
+        }
+
+    };
+
+    /* raw values */
+
+    template <>
+    struct ValueBinding<sqlite3_value*> {
+
+        static inline void Value(sqlite3_value* const pValue, sqlite3_value*& arg) {
+            arg = pValue;
+        }
+
+        static inline void Result(sqlite3_context* const pContext, sqlite3_value* const& arg) {
+            sqlite3_result_value(pContext, arg);
+        }
+
+    };
+
+    /* string types */
+
+    template <>
+    struct ValueBinding<const char*> {
+
+        static inline void Result(sqlite3_context* const pContext, const char* arg) {
+            if (!arg) sqlite3_result_null(pContext);
+            else sqlite3_result_text(pContext, arg, -1, SQLITE_TRANSIENT);
+        }
+
+    };
+
+    template <>
+    struct ValueBinding<std::string_view> {
+
+        /* the view points into the value and is valid until the function returns. */
+        static inline void Value(sqlite3_value* const pValue, std::string_view& arg) {
+            const unsigned char* pText = sqlite3_value_text(pValue);
+            const std::int32_t len = sqlite3_value_bytes(pValue);
+            arg = { reinterpret_cast<const char*>(pText), static_cast<std::size_t>(len) };
+        }
+
+        static inline void Result(sqlite3_context* const pContext, const std::string_view& arg) {
+            sqlite3_result_text64(pContext, (arg.data() ? arg.data() : ""), arg.length(), SQLITE_TRANSIENT, SQLITE_UTF8);
+        }
+
+    };
+
+    template <>
+    struct ValueBinding<std::string> {
+
+        static inline void Value(sqlite3_value* const pValue, std::string& arg) {
+            std::string_view text = { };
+            ValueBinding<std::string_view>::Value(pValue, text);
+            arg = text;
+        }
+
+        static inline void Result(sqlite3_context* const pContext, const std::string& arg) {
+            ValueBinding<std::string_view>::Result(pContext, arg);
+        }
+
+    };
+
+    /* binary types */
+
+    template <>
+    struct ValueBinding<std::span<const std::byte>> {
+
+        /* the span points into the value and is valid until the function returns. */
+        static inline void Value(sqlite3_value* const pValue, std::span<const std::byte>& arg) {
+            const void* pBlob = sqlite3_value_blob(pValue);
+            const std::int32_t len = sqlite3_value_bytes(pValue);
+            arg = { static_cast<const std::byte*>(pBlob), static_cast<std::size_t>(len) };
+        }
+
+        static inline void Result(sqlite3_context* const pContext, const std::span<const std::byte>& arg) {
+            if (arg.empty()) sqlite3_result_zeroblob(pContext, 0);
+            else sqlite3_result_blob64(pContext, arg.data(), arg.size(), SQLITE_TRANSIENT);
+        }
+
+    };
+
+    template <>
+    struct ValueBinding<std::vector<std::byte>> {
+
+        static inline void Value(sqlite3_value* const pValue, std::vector<std::byte>& arg) {
+            std::span<const std::byte> blob = { };
+            ValueBinding<std::span<const std::byte>>::Value(pValue, blob);
+            arg.assign(blob.begin(), blob.end());
+        }
+
+        static inline void Result(sqlite3_context* const pContext, const std::vector<std::byte>& arg) {
+            ValueBinding<std::span<const std::byte>>::Result(pContext, arg);
+        }
+
+    };
+
+    template <>
+    struct ValueBinding<ZeroBlob> {
+
+        static inline void Result(sqlite3_context* const pContext, const ZeroBlob& arg) {
+            sqlite3_result_zeroblob64(pContext, arg.Size);
+        }
+
+    };
+
+    /* integer types */
+
+    template <typename T>
+    requires (std::is_same<T, std::int64_t>::value || std::is_same<T, std::uint64_t>::value)
+    struct ValueBinding<T> {
+
+        static inline void Value(sqlite3_value* const pValue, T& arg) {
+            arg = static_cast<T>(sqlite3_value_int64(pValue));
+        }
+
+        static inline void Result(sqlite3_context* const pContext, const T& arg) {
+            sqlite3_result_int64(pContext, static_cast<sqlite3_int64>(arg));
+        }
+
+    };
+
+    template <typename T>
+    requires (std::is_integral<T>::value && !(std::is_same<T, std::int64_t>::value || std::is_same<T, std::uint64_t>::value))
+    struct ValueBinding<T> {
+
+        static inline void Value(sqlite3_value* const pValue, T& arg) {
+            arg = static_cast<T>(sqlite3_value_int(pValue));
+        }
+
+        static inline void Result(sqlite3_context* const pContext, const T& arg) {
+            sqlite3_result_int(pContext, static_cast<std::int32_t>(arg));
+        }
+
+    };
+
+    /* floating point types */
+
+    template <>
+    struct ValueBinding<double> {
+
+        static inline void Value(sqlite3_value* const pValue, double& arg) {
+            arg = sqlite3_value_double(pValue);
+        }
+
+        static inline void Result(sqlite3_context* const pContext, const double& arg) {
+            sqlite3_result_double(pContext, arg);
+        }
+
+    };
+
+    template <>
+    struct ValueBinding<float> {
+
+        static inline void Value(sqlite3_value* const pValue, float& arg) {
+            arg = static_cast<float>(sqlite3_value_double(pValue));
+        }
+
+        static inline void Result(sqlite3_context* const pContext, const float& arg) {
+            sqlite3_result_double(pContext, static_cast<double>(arg));
+        }
+
+    };
+
+    /* boolean type */
+
+    template <>
+    struct ValueBinding<bool> {
+
+        static inline void Value(sqlite3_value* const pValue, bool& arg) {
+            arg = (sqlite3_value_int(pValue) != 0);
+        }
+
+        static inline void Result(sqlite3_context* const pContext, const bool& arg) {
+            sqlite3_result_int(pContext, (arg ? 1 : 0));
+        }
+
+    };
+
+    /* std::optional */
+
+    template <typename T>
+    struct ValueBinding<std::optional<T>> {
+
+        static inline void Value(sqlite3_value* const pValue, std::optional<T>& arg) {
+            if (sqlite3_value_type(pValue) == SQLITE_NULL) arg = std::nullopt;
+            else ValueBinding<T>::Value(pValue, arg.emplace());
+        }
+
+        static inline void Result(sqlite3_context* const pContext, const std::optional<T>& arg) {
+            if (arg.has_value()) ValueBinding<T>::Result(pContext, arg.value());
+            else sqlite3_result_null(pContext);
+        }
+
+    };
+
+    template <>
+    struct ValueBinding<std::nullopt_t> {
+
+        static inline void Result(sqlite3_context* const pContext, const std::nullopt_t&) {
+            sqlite3_result_null(pContext);
+        }
+
+    };
+
+}
+#endif // VSQLITE_NO_DEFAULT_VALUEBINDING_SPECIALIZATIONS
+
+#endif // _VSQLITE_VALUEBINDING_H_
\ No newline at end of file
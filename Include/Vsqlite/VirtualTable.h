@@ -0,0 +1,630 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#ifndef _VSQLITE_VIRTUALTABLE_H_
+#define _VSQLITE_VIRTUALTABLE_H_
+
+#include <Vsqlite/SQLite.h>
+#include <Vsqlite/SqliteException.h>
+#include <Vsqlite/RowMapping.h>
+#include <Vsqlite/ValueBinding.h>
+#include <Vsqlite/Database.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <span>
+#include <optional>
+#include <tuple>
+#include <ranges>
+#include <iterator>
+#include <limits>
+#include <algorithm>
+#include <type_traits>
+#include <concepts>
+#include <utility>
+#include <exception>
+#include <stdexcept>
+#include <cstdint>
+#include <cstddef>
+
+namespace Vsqlite {
+
+    /**
+     * Controls how Database::RegisterVirtualTable exposes a container.
+     */
+    struct VirtualTableOptions {
+
+        /**
+         * Make the table available only under the module name, without CREATE VIRTUAL TABLE.
+         * Otherwise, CREATE VIRTUAL TABLE name USING module can be used as well; such tables
+         * are recorded in the schema, so prefer creating them in the temp schema.
+         */
+        bool Eponymous = true;
+
+        /**
+         * Name of the column that holds the keys of a map container.
+         */
+        std::string KeyColumn = "Key";
+
+    };
+
+    /**
+     * A container with find: std::map, std::unordered_map and similar containers whose
+     * mapped type is a struct mapped with VSQLITE_MAP. Its key is exposed as the first column.
+     */
+    template <typename C>
+    concept IsMapContainer = requires (const C& container, const typename C::key_type& key) {
+        typename C::mapped_type;
+        container.find(key);
+    };
+
+    /**
+     * A map container whose keys are ordered, such as std::map, so that ranges of keys can be looked up.
+     */
+    template <typename C>
+    concept IsOrderedMapContainer = IsMapContainer<C> && requires (const C& container, const typename C::key_type& key) {
+        container.lower_bound(key);
+        container.upper_bound(key);
+    };
+
+    /**
+     * Returns the SQL type of a column holding values of type T.
+     *
+     * @tparam T
+     */
+    template <typename T>
+    inline constexpr std::string_view ColumnAffinity = "";
+
+    template <typename T>
+    requires std::is_integral_v<T>
+    inline constexpr std::string_view ColumnAffinity<T> = "INTEGER";
+
+    template <typename T>
+    requires std::is_floating_point_v<T>
+    inline constexpr std::string_view ColumnAffinity<T> = "REAL";
+
+    template <>
+    inline constexpr std::string_view ColumnAffinity<std::string> = "TEXT";
+
+    template <>
+    inline constexpr std::string_view ColumnAffinity<std::string_view> = "TEXT";
+
+    template <>
+    inline constexpr std::string_view ColumnAffinity<std::vector<std::byte>> = "BLOB";
+
+    template <typename T>
+    inline constexpr std::string_view ColumnAffinity<std::optional<T>> = ColumnAffinity<T>;
+
+    /**
+     * sqlite3_module implementation that exposes a container of mapped structs as a read-only table.
+     *
+     * Equality constraints on the key of a map container, range constraints on the key of an
+     * ordered map container, and equality and range constraints on the rowid (the element index)
+     * of a random access range are answered by the container instead of a full scan. Only
+     * constraints that compare with the BINARY collation are answered this way.
+     *
+     * The rowid of a row is the position of its element in the container's iteration order,
+     * so it does not depend on the query plan.
+     */
+    template <typename C>
+    class VirtualTable {
+
+    private:
+        static constexpr bool IsMap = IsMapContainer<C>;
+        static constexpr bool IsOrdered = IsOrderedMapContainer<C>;
+        static constexpr bool IsRandomAccess = (!IsMap && std::ranges::random_access_range<const C>);
+
+        template <typename T>
+        struct RowTypeOf {
+            using Type = std::ranges::range_value_t<const T>;
+        };
+
+        template <IsMapContainer T>
+        struct RowTypeOf<T> {
+            using Type = typename T::mapped_type;
+        };
+
+        template <typename T>
+        struct KeyTypeOf {
+            using Type = std::int64_t;
+        };
+
+        template <IsMapContainer T>
+        struct KeyTypeOf<T> {
+            using Type = typename T::key_type;
+        };
+
+        using Row = typename RowTypeOf<C>::Type;
+        using Key = typename KeyTypeOf<C>::Type;
+        using Iterator = std::ranges::iterator_t<const C>;
+
+        static_assert(IsMapped<Row>, "The rows of the container must be structs mapped with VSQLITE_MAP.");
+
+        static constexpr std::size_t FieldCount = ParameterCount<Row>;
+        static constexpr std::int32_t FirstField = (IsMap ? 1 : 0);
+
+        /**
+         * Whether keys of this type can be looked up from SQL values without changing the
+         * result of a comparison, and so whether constraints on the key are used.
+         */
+        static constexpr bool IsIndexable = (IsMap || IsRandomAccess) && (
+            (std::is_arithmetic_v<Key> && !std::is_same_v<Key, bool>) ||
+            std::is_same_v<Key, std::string> ||
+            std::is_same_v<Key, std::string_view>
+        );
+
+        /**
+         * Column that is looked up through the container: the key of a map, or the rowid.
+         */
+        static constexpr std::int32_t IndexColumn = (IsMap ? 0 : -1);
+
+        enum Plan : std::int32_t {
+            Scan = 0,
+            Equal = 1,
+            Lower = 2,
+            Upper = 4,
+            LowerInclusive = 8,
+            UpperInclusive = 16,
+        };
+
+        struct Context {
+            const C* pContainer;
+            VirtualTableOptions Options;
+        };
+
+        struct Table : sqlite3_vtab {
+            const Context* pContext;
+        };
+
+        struct Cursor : sqlite3_vtab_cursor {
+            Iterator Current;
+            Iterator End;
+        };
+
+        static sqlite3_module MakeModule(const bool eponymous);
+
+        static std::string GetDeclaration(const VirtualTableOptions& options);
+
+        static bool CanLookUp(sqlite3_value* const pValue);
+
+        static std::optional<Key> GetKey(sqlite3_value* const pValue);
+
+        static const Row& GetRow(const Iterator& it);
+
+        static std::int32_t SetError(sqlite3_vtab* const pTable) noexcept;
+
+        static int Connect(sqlite3* pDatabase, void* pAux, int argc, const char* const* argv, sqlite3_vtab** ppTable, char** pzError);
+        static int BestIndex(sqlite3_vtab* pTable, sqlite3_index_info* pInfo);
+        static int Disconnect(sqlite3_vtab* pTable);
+        static int Open(sqlite3_vtab* pTable, sqlite3_vtab_cursor** ppCursor);
+        static int Close(sqlite3_vtab_cursor* pCursor);
+        static int Filter(sqlite3_vtab_cursor* pCursor, int idxNum, const char* idxStr, int argc, sqlite3_value** argv);
+        static int Next(sqlite3_vtab_cursor* pCursor);
+        static int Eof(sqlite3_vtab_cursor* pCursor);
+        static int Column(sqlite3_vtab_cursor* pCursor, sqlite3_context* pContext, int column);
+        static int Rowid(sqlite3_vtab_cursor* pCursor, sqlite3_int64* pRowid);
+
+    public:
+
+        /**
+         * Registers the module on a database connection.
+         *
+         * @param pDatabase An SQLite database.
+         * @param name Module name.
+         * @param container The container. It is not copied and must outlive the database
+         * connection, and must not be modified while a statement reads from the table.
+         * @param options Table options.
+         * @exception SqliteException
+         */
+        static void Register(sqlite3* const pDatabase, const std::string_view name, const C& container, const VirtualTableOptions& options);
+
+    };
+
+    template <typename C>
+    inline sqlite3_module VirtualTable<C>::MakeModule(const bool eponymous) {
+
+        sqlite3_module module = { };
+        module.iVersion = 1;
+        module.xCreate = (eponymous ? nullptr : &Connect);
+        module.xConnect = &Connect;
+        module.xBestIndex = &BestIndex;
+        module.xDisconnect = &Disconnect;
+        module.xDestroy = &Disconnect;
+        module.xOpen = &Open;
+        module.xClose = &Close;
+        module.xFilter = &Filter;
+        module.xNext = &Next;
+        module.xEof = &Eof;
+        module.xColumn = &Column;
+        module.xRowid = &Rowid;
+
+        return module;
+    }
+
+    template <typename C>
+    inline std::string VirtualTable<C>::GetDeclaration(const VirtualTableOptions& options) {
+
+        const auto quote = [] (const std::string_view name) {
+            std::string identifier = "\"";
+            for (const char ch : name) {
+                if (ch == '"') identifier += '"';
+                identifier += ch;
+            }
+            return (identifier + "\"");
+        };
+
+        std::string sql = "CREATE TABLE x(";
+
+        if constexpr (IsMap) sql += (quote(options.KeyColumn) + " " + std::string(ColumnAffinity<Key>) + ", ");
+
+        [&] <std::size_t... Is> (std::index_sequence<Is...>) {
+            ((sql += (quote(RowMapping<Row>::Names[Is]) + " "
+                + std::string(ColumnAffinity<std::remove_cvref_t<decltype(std::declval<const Row&>().*std::get<Is>(RowMapping<Row>::Fields))>>)
+                + ((Is + 1 < FieldCount) ? ", " : ""))), ...);
+        }(std::make_index_sequence<FieldCount> { });
+
+        return (sql + ")");
+    }
+
+    template <typename C>
+    inline bool VirtualTable<C>::CanLookUp(sqlite3_value* const pValue) {
+
+        const std::int32_t type = sqlite3_value_type(pValue);
+
+        if constexpr (std::is_integral_v<Key>) {
+            if (type != SQLITE_INTEGER) return false;
+            const std::int64_t value = sqlite3_value_int64(pValue);
+            if constexpr (std::is_signed_v<Key>) return ((value >= std::numeric_limits<Key>::min()) && (value <= std::numeric_limits<Key>::max()));
+            else return ((value >= 0) && (static_cast<std::uint64_t>(value) <= std::numeric_limits<Key>::max()));
+        }
+        else if constexpr (std::is_floating_point_v<Key>) return ((type == SQLITE_INTEGER) || (type == SQLITE_FLOAT));
+        else return (type == SQLITE_TEXT);
+    }
+
+    template <typename C>
+    inline std::optional<typename VirtualTable<C>::Key> VirtualTable<C>::GetKey(sqlite3_value* const pValue) {
+
+        // Values that would not compare the same way in C++ are not looked up; the constraint
+        // is then checked by SQLite on a wider scan.
+        if (!CanLookUp(pValue)) return std::nullopt;
+
+        Key key = { };
+        ValueBinding<Key>::Value(pValue, key);
+
+        return key;
+    }
+
+    template <typename C>
+    inline const typename VirtualTable<C>::Row& VirtualTable<C>::GetRow(const Iterator& it) {
+        if constexpr (IsMap) return it->second;
+        else return *it;
+    }
+
+    template <typename C>
+    inline std::int32_t VirtualTable<C>::SetError(sqlite3_vtab* const pTable) noexcept {
+
+        try {
+            throw;
+        }
+        catch (const std::bad_alloc&) {
+            return SQLITE_NOMEM;
+        }
+        catch (const std::exception& ex) {
+            sqlite3_free(pTable->zErrMsg);
+            pTable->zErrMsg = sqlite3_mprintf("%s", ex.what());
+        }
+        catch (...) {
+            sqlite3_free(pTable->zErrMsg);
+            pTable->zErrMsg = sqlite3_mprintf("%s", "Unknown exception.");
+        }
+
+        return SQLITE_ERROR;
+    }
+
+    template <typename C>
+    inline int VirtualTable<C>::Connect(sqlite3* pDatabase, void* pAux, int, const char* const*, sqlite3_vtab** ppTable, char** pzError) {
+
+        const Context* pContext = static_cast<const Context*>(pAux);
+
+        try {
+
+            const std::string declaration = GetDeclaration(pContext->Options);
+
+            std::int32_t res = sqlite3_declare_vtab(pDatabase, declaration.c_str());
+            if (res != SQLITE_OK) {
+                *pzError = sqlite3_mprintf("%s", sqlite3_errmsg(pDatabase));
+                return res;
+            }
+
+            sqlite3_vtab_config(pDatabase, SQLITE_VTAB_INNOCUOUS);
+
+            Table* pTable = new Table();
+            pTable->pContext = pContext;
+            *ppTable = pTable;
+
+        }
+        catch (const std::bad_alloc&) {
+            return SQLITE_NOMEM;
+        }
+
+        return SQLITE_OK;
+    }
+
+    template <typename C>
+    inline int VirtualTable<C>::BestIndex(sqlite3_vtab* pTable, sqlite3_index_info* pInfo) {
+
+        const C& container = *static_cast<Table*>(pTable)->pContext->pContainer;
+
+        double rows = 1'000'000.00;
+        if constexpr (std::ranges::sized_range<const C>) rows = static_cast<double>(std::max<std::size_t>(std::ranges::size(container), 1));
+
+        pInfo->idxNum = Plan::Scan;
+        pInfo->estimatedCost = rows;
+        pInfo->estimatedRows = static_cast<sqlite3_int64>(rows);
+
+        if constexpr (IsIndexable) {
+
+            std::int32_t equal = -1;
+            std::int32_t lower = -1;
+            std::int32_t upper = -1;
+
+            for (std::int32_t i = 0; i < pInfo->nConstraint; ++i) {
+
+                const sqlite3_index_info::sqlite3_index_constraint& constraint = pInfo->aConstraint[i];
+                if (!constraint.usable || (constraint.iColumn != IndexColumn)) continue;
+
+                // The container compares keys bytewise; e.g. Key = 'abc' COLLATE NOCASE is left to SQLite.
+                const char* collation = sqlite3_vtab_collation(pInfo, i);
+                if ((collation != nullptr) && (sqlite3_stricmp(collation, "BINARY") != 0)) continue;
+
+                switch (constraint.op) {
+
+                case SQLITE_INDEX_CONSTRAINT_EQ:
+                    if (equal < 0) equal = i;
+                    break;
+
+                case SQLITE_INDEX_CONSTRAINT_GT:
+                case SQLITE_INDEX_CONSTRAINT_GE:
+                    if (lower < 0) lower = i;
+                    break;
+
+                case SQLITE_INDEX_CONSTRAINT_LT:
+                case SQLITE_INDEX_CONSTRAINT_LE:
+                    if (upper < 0) upper = i;
+                    break;
+
+                }
+
+            }
+
+            // Constraints are not omitted: lookups may return more rows than match, but never fewer.
+            if (equal >= 0) {
+                pInfo->idxNum = Plan::Equal;
+                pInfo->aConstraintUsage[equal].argvIndex = 1;
+                pInfo->estimatedCost = 1.00;
+                pInfo->estimatedRows = 1;
+                pInfo->idxFlags = SQLITE_INDEX_SCAN_UNIQUE;
+            }
+            else if ((IsOrdered || IsRandomAccess) && ((lower >= 0) || (upper >= 0))) {
+
+                std::int32_t plan = 0;
+                std::int32_t argvIndex = 0;
+
+                if (lower >= 0) {
+                    plan |= Plan::Lower;
+                    if (pInfo->aConstraint[lower].op == SQLITE_INDEX_CONSTRAINT_GE) plan |= Plan::LowerInclusive;
+                    pInfo->aConstraintUsage[lower].argvIndex = ++argvIndex;
+                }
+
+                if (upper >= 0) {
+                    plan |= Plan::Upper;
+                    if (pInfo->aConstraint[upper].op == SQLITE_INDEX_CONSTRAINT_LE) plan |= Plan::UpperInclusive;
+                    pInfo->aConstraintUsage[upper].argvIndex = ++argvIndex;
+                }
+
+                pInfo->idxNum = plan;
+                pInfo->estimatedCost = (rows / ((argvIndex == 2) ? 4.00 : 2.00));
+                pInfo->estimatedRows = static_cast<sqlite3_int64>(pInfo->estimatedCost);
+
+            }
+
+        }
+
+        // Ordered maps and random access ranges are scanned in key and rowid order.
+        if constexpr (IsOrdered || IsRandomAccess) {
+            if ((pInfo->nOrderBy == 1) && (pInfo->aOrderBy[0].iColumn == IndexColumn) && !pInfo->aOrderBy[0].desc)
+                pInfo->orderByConsumed = 1;
+        }
+
+        return SQLITE_OK;
+    }
+
+    template <typename C>
+    inline int VirtualTable<C>::Disconnect(sqlite3_vtab* pTable) {
+        delete static_cast<Table*>(pTable);
+        return SQLITE_OK;
+    }
+
+    template <typename C>
+    inline int VirtualTable<C>::Open(sqlite3_vtab*, sqlite3_vtab_cursor** ppCursor) {
+
+        try {
+            *ppCursor = new Cursor();
+        }
+        catch (const std::bad_alloc&) {
+            return SQLITE_NOMEM;
+        }
+
+        return SQLITE_OK;
+    }
+
+    template <typename C>
+    inline int VirtualTable<C>::Close(sqlite3_vtab_cursor* pCursor) {
+        delete static_cast<Cursor*>(pCursor);
+        return SQLITE_OK;
+    }
+
+    template <typename C>
+    inline int VirtualTable<C>::Filter(sqlite3_vtab_cursor* pCursor, int idxNum, const char*, int, sqlite3_value** argv) {
+
+        Cursor& cursor = *static_cast<Cursor*>(pCursor);
+        const C& container = *static_cast<Table*>(pCursor->pVtab)->pContext->pContainer;
+
+        try {
+
+            cursor.Current = std::ranges::begin(container);
+            cursor.End = std::ranges::end(container);
+
+            if constexpr (IsIndexable) {
+
+                const std::optional<Key> first = ((idxNum & (Plan::Equal | Plan::Lower)) ? GetKey(argv[0]) : std::nullopt);
+                const std::optional<Key> last = ((idxNum & Plan::Upper) ? GetKey(argv[(idxNum & Plan::Lower) ? 1 : 0]) : std::nullopt);
+
+                if constexpr (IsRandomAccess) {
+
+                    // Clamp rowids to [0, size], so that bounds never overflow.
+                    const std::int64_t size = static_cast<std::int64_t>(std::ranges::size(container));
+                    const auto clamp = [size] (const std::int64_t rowid) { return std::clamp<std::int64_t>(rowid, -1, size); };
+
+                    std::int64_t begin = 0;
+                    std::int64_t end = size;
+
+                    if ((idxNum & Plan::Equal) && first.has_value()) {
+                        begin = std::max<std::int64_t>(clamp(first.value()), 0);
+                        end = std::min<std::int64_t>((clamp(first.value()) + 1), size);
+                    }
+                    else {
+                        if (first.has_value()) begin = std::max<std::int64_t>((clamp(first.value()) + ((idxNum & Plan::LowerInclusive) ? 0 : 1)), 0);
+                        if (last.has_value()) end = std::min<std::int64_t>((clamp(last.value()) + ((idxNum & Plan::UpperInclusive) ? 1 : 0)), size);
+                    }
+
+                    end = std::max(begin, end);
+                    cursor.Current = (std::ranges::begin(container) + begin);
+                    cursor.End = (std::ranges::begin(container) + end);
+
+                }
+                else if (idxNum & Plan::Equal) {
+
+                    if (first.has_value()) {
+                        cursor.Current = container.find(first.value());
+                        cursor.End = ((cursor.Current == cursor.End) ? cursor.End : std::next(cursor.Current));
+                    }
+
+                }
+                else if constexpr (IsOrdered) {
+
+                    if (first.has_value()) cursor.Current = ((idxNum & Plan::LowerInclusive) ? container.lower_bound(first.value()) : container.upper_bound(first.value()));
+                    if (last.has_value()) cursor.End = ((idxNum & Plan::UpperInclusive) ? container.upper_bound(last.value()) : container.lower_bound(last.value()));
+
+                    // An empty range, e.g. Key > 5 AND Key < 3.
+                    if (first.has_value() && last.has_value() && (container.key_comp()(last.value(), first.value())))
+                        cursor.Current = cursor.End;
+
+                }
+
+            }
+
+        }
+        catch (...) {
+            return SetError(pCursor->pVtab);
+        }
+
+        return SQLITE_OK;
+    }
+
+    template <typename C>
+    inline int VirtualTable<C>::Next(sqlite3_vtab_cursor* pCursor) {
+        Cursor& cursor = *static_cast<Cursor*>(pCursor);
+        ++cursor.Current;
+        return SQLITE_OK;
+    }
+
+    template <typename C>
+    inline int VirtualTable<C>::Eof(sqlite3_vtab_cursor* pCursor) {
+        const Cursor& cursor = *static_cast<Cursor*>(pCursor);
+        return ((cursor.Current == cursor.End) ? 1 : 0);
+    }
+
+    template <typename C>
+    inline int VirtualTable<C>::Column(sqlite3_vtab_cursor* pCursor, sqlite3_context* pContext, int column) {
+
+        const Cursor& cursor = *static_cast<Cursor*>(pCursor);
+
+        try {
+
+            if constexpr (IsMap) {
+                if (column == 0) {
+                    ValueBinding<Key>::Result(pContext, cursor.Current->first);
+                    return SQLITE_OK;
+                }
+            }
+
+            const Row& row = GetRow(cursor.Current);
+            const std::size_t field = static_cast<std::size_t>(column - FirstField);
+
+            [&] <std::size_t... Is> (std::index_sequence<Is...>) {
+                const auto result = [&] (const auto& value) {
+                    ValueBinding<std::remove_cvref_t<decltype(value)>>::Result(pContext, value);
+                    return true;
+                };
+
+                static_cast<void>((((field == Is) && result(row.*std::get<Is>(RowMapping<Row>::Fields))) || ...));
+            }(std::make_index_sequence<FieldCount> { });
+
+        }
+        catch (...) {
+            return SetError(pCursor->pVtab);
+        }
+
+        return SQLITE_OK;
+    }
+
+    template <typename C>
+    inline int VirtualTable<C>::Rowid(sqlite3_vtab_cursor* pCursor, sqlite3_int64* pRowid) {
+        // Only computed when a statement reads the rowid; this is linear for maps.
+        const C& container = *static_cast<Table*>(pCursor->pVtab)->pContext->pContainer;
+        *pRowid = static_cast<sqlite3_int64>(std::ranges::distance(std::ranges::begin(container), static_cast<Cursor*>(pCursor)->Current));
+        return SQLITE_OK;
+    }
+
+    template <typename C>
+    inline void VirtualTable<C>::Register(sqlite3* const pDatabase, const std::string_view name, const C& container, const VirtualTableOptions& options) {
+
+        static const sqlite3_module eponymousModule = MakeModule(true);
+        static const sqlite3_module module = MakeModule(false);
+
+        // SQLite calls the destructor if registration fails as well.
+        const std::int32_t res = sqlite3_create_module_v2(
+            pDatabase,
+            std::string(name).c_str(),
+            (options.Eponymous ? &eponymousModule : &module),
+            new Context { &container, options },
+            [] (void* pContext) { delete static_cast<Context*>(pContext); }
+        );
+
+        if (res != SQLITE_OK) throw SqliteException(pDatabase);
+
+    }
+
+    template <typename C>
+    inline void Database::RegisterVirtualTable(const std::string_view name, const C& container, const VirtualTableOptions& options) {
+
+        if (name.empty())
+            throw std::invalid_argument("'name': Empty string.");
+
+        VirtualTable<C>::Register(this->m_pDatabase, name, container, options);
+
+    }
+
+    template <typename C>
+    inline void Database::RegisterVirtualTable(const std::string_view name, const C& container) {
+        this->RegisterVirtualTable(name, container, VirtualTableOptions { });
+    }
+
+}
+
+#endif // _VSQLITE_VIRTUALTABLE_H_
\ No newline at end of file
@@ -0,0 +1,153 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#include "Test.h"
+
+#include <Vsqlite/Async.h>
+
+#include <coroutine>
+#include <functional>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <exception>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+using namespace Vsqlite;
+using namespace Vsqlite::Tests;
+
+namespace {
+
+    /**
+     * A coroutine that starts immediately and is not awaited.
+     */
+    struct Task {
+        struct promise_type {
+            Task get_return_object(void) { return { }; }
+            std::suspend_never initial_suspend(void) noexcept { return { }; }
+            std::suspend_never final_suspend(void) noexcept { return { }; }
+            void return_void(void) { }
+            void unhandled_exception(void) { std::terminate(); }
+        };
+    };
+
+    /**
+     * An event loop that runs posted work on the thread that calls RunUntilDone.
+     */
+    class LoopExecutor : public Executor {
+
+    private:
+        std::deque<std::function<void()>> m_queue;
+        std::mutex m_mutex;
+        std::condition_variable m_available;
+        bool m_done = false;
+
+    public:
+        void Post(std::function<void()> work) override {
+            {
+                const std::lock_guard<std::mutex> lock(this->m_mutex);
+                this->m_queue.push_back(std::move(work));
+            }
+            this->m_available.notify_one();
+        }
+
+        void Stop(void) {
+            this->Post([this] () { this->m_done = true; });
+        }
+
+        void RunUntilDone(void) {
+            while (!this->m_done) {
+                std::function<void()> work = nullptr;
+                {
+                    std::unique_lock<std::mutex> lock(this->m_mutex);
+                    this->m_available.wait(lock, [this] () { return !this->m_queue.empty(); });
+                    work = std::move(this->m_queue.front());
+                    this->m_queue.pop_front();
+                }
+                work();
+            }
+        }
+
+    };
+
+    struct Outcome {
+        std::size_t Rows = 0;
+        bool Stepped = false;
+        bool Failed = false;
+        std::thread::id Thread = { };
+    };
+
+    Task QueryOnLoop(Database& db, LoopExecutor& loop, Outcome& outcome) {
+        const auto rows = co_await db.QueryAsync<std::int64_t>(loop, "SELECT 1 UNION ALL SELECT 2;");
+        outcome.Rows = rows.size();
+        outcome.Thread = std::this_thread::get_id();
+        loop.Stop();
+    }
+
+    Task StepOnLoop(Statement& statement, LoopExecutor& loop, Outcome& outcome) {
+        outcome.Stepped = co_await statement.StepAsync(loop);
+        outcome.Thread = std::this_thread::get_id();
+        loop.Stop();
+    }
+
+    Task FailOnLoop(Database& db, LoopExecutor& loop, Outcome& outcome) {
+        try {
+            static_cast<void>(co_await db.QueryAsync<std::int64_t>(loop, "SELECT * FROM missing;"));
+        }
+        catch (const SqliteException&) {
+            outcome.Failed = true;
+        }
+        outcome.Thread = std::this_thread::get_id();
+        loop.Stop();
+    }
+
+}
+
+VSQLITE_TEST(Async, QueryResumesOnCallerExecutor) {
+
+    Database db = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    LoopExecutor loop = { };
+    Outcome outcome = { };
+
+    QueryOnLoop(db, loop, outcome);
+    loop.RunUntilDone();
+
+    VSQLITE_CHECK(outcome.Rows == 2);
+    VSQLITE_CHECK(outcome.Thread == std::this_thread::get_id());
+
+}
+
+VSQLITE_TEST(Async, StepResumesOnCallerExecutor) {
+
+    Database db = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    Statement statement = db.PrepareStatement("SELECT 1;", 0);
+    LoopExecutor loop = { };
+    Outcome outcome = { };
+
+    StepOnLoop(statement, loop, outcome);
+    loop.RunUntilDone();
+
+    VSQLITE_CHECK(outcome.Stepped);
+    VSQLITE_CHECK(outcome.Thread == std::this_thread::get_id());
+
+}
+
+VSQLITE_TEST(Async, ErrorsResumeOnCallerExecutor) {
+
+    Database db = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    LoopExecutor loop = { };
+    Outcome outcome = { };
+
+    FailOnLoop(db, loop, outcome);
+    loop.RunUntilDone();
+
+    VSQLITE_CHECK(outcome.Failed);
+    VSQLITE_CHECK(outcome.Thread == std::this_thread::get_id());
+
+}
\ No newline at end of file
@@ -0,0 +1,128 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#include "Test.h"
+
+#include <Vsqlite/AsyncWriter.h>
+
+#include <vector>
+#include <future>
+#include <thread>
+#include <chrono>
+#include <stdexcept>
+#include <cstdint>
+#include <cstddef>
+
+using namespace Vsqlite;
+using namespace Vsqlite::Tests;
+
+namespace {
+
+    Database OpenWriter(const TemporaryFile& file) {
+        Database db = { file.GetPath(), (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+        db.Execute("CREATE TABLE IF NOT EXISTS t(Producer INTEGER, Seq INTEGER);");
+        return db;
+    }
+
+    std::int64_t Count(const TemporaryFile& file) {
+        Database db = { file.GetPath(), SQLITE_OPEN_READONLY };
+        std::int64_t count = 0;
+        db.Execute("SELECT count(*) FROM t;").Fetch(count);
+        return count;
+    }
+
+}
+
+VSQLITE_TEST(AsyncWriter, ProducersKeepOrderAndAllJobsCommit) {
+
+    constexpr std::int64_t Producers = 4;
+    constexpr std::int64_t JobsPerProducer = 500;
+
+    const TemporaryFile file = TemporaryFile("writer_producers");
+
+    {
+        AsyncWriter writer = { OpenWriter(file), AsyncWriterOptions { .MaxBatchSize = 64 } };
+        std::vector<std::thread> producers = { };
+        std::vector<std::vector<std::future<void>>> futures = std::vector<std::vector<std::future<void>>>(Producers);
+
+        for (std::int64_t p = 0; p < Producers; ++p) {
+            producers.emplace_back([&writer, &futures, p] () {
+                for (std::int64_t seq = 0; seq < JobsPerProducer; ++seq)
+                    futures[p].push_back(writer.Execute("INSERT INTO t(Producer, Seq) VALUES (?, ?);", p, seq));
+            });
+        }
+
+        for (std::thread& producer : producers) producer.join();
+        for (std::vector<std::future<void>>& jobs : futures)
+            for (std::future<void>& job : jobs) job.get();
+
+        const AsyncWriterStatistics statistics = writer.GetStatistics();
+        VSQLITE_CHECK(statistics.Jobs == static_cast<std::uint64_t>(Producers * JobsPerProducer));
+        VSQLITE_CHECK((statistics.Batches > 0) && (statistics.Batches <= statistics.Jobs));
+    }
+
+    VSQLITE_CHECK(Count(file) == (Producers * JobsPerProducer));
+
+    // Jobs of one producer are committed in submission order.
+    Database db = { file.GetPath(), SQLITE_OPEN_READONLY };
+    Statement select = db.PrepareStatement("SELECT Producer, Seq FROM t ORDER BY rowid;", 0);
+    std::vector<std::int64_t> next = std::vector<std::int64_t>(Producers, 0);
+
+    for (const auto& [producer, seq] : select.Rows<std::int64_t, std::int64_t>()) {
+        VSQLITE_CHECK(seq == next[producer]);
+        ++next[producer];
+    }
+
+}
+
+VSQLITE_TEST(AsyncWriter, FailingJobRollsBackOnlyItself) {
+
+    const TemporaryFile file = TemporaryFile("writer_savepoint");
+
+    {
+        AsyncWriter writer = { OpenWriter(file), AsyncWriterOptions { .MaxBatchSize = 3, .MaxLatency = std::chrono::seconds(5) } };
+
+        std::future<void> first = writer.Execute("INSERT INTO t VALUES (1, 1);");
+        std::future<void> failing = writer.Submit([] (Database& database) {
+            database.Execute("INSERT INTO t VALUES (2, 2);");
+            database.Execute("INSERT INTO missing VALUES (2);");
+        });
+        std::future<void> last = writer.Execute("INSERT INTO t VALUES (3, 3);");
+
+        first.get();
+        VSQLITE_CHECK_THROWS(failing.get(), SqliteException);
+        last.get();
+
+        VSQLITE_CHECK(writer.GetStatistics().Batches == 1);
+    }
+
+    Database db = { file.GetPath(), SQLITE_OPEN_READONLY };
+    std::int64_t sum = 0;
+    db.Execute("SELECT sum(Producer) FROM t;").Fetch(sum);
+    VSQLITE_CHECK(sum == 4);
+
+}
+
+VSQLITE_TEST(AsyncWriter, ShutdownDrainsQueue) {
+
+    const TemporaryFile file = TemporaryFile("writer_shutdown");
+    std::vector<std::future<void>> futures = { };
+
+    {
+        // A long flush window: the destructor must not wait for it, nor drop queued jobs.
+        AsyncWriter writer = { OpenWriter(file), AsyncWriterOptions { .MaxBatchSize = 16, .MaxLatency = std::chrono::seconds(30) } };
+        for (std::int64_t i = 0; i < 100; ++i)
+            futures.push_back(writer.Execute("INSERT INTO t VALUES (0, ?);", i));
+    }
+
+    for (std::future<void>& future : futures) {
+        VSQLITE_CHECK(future.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+        future.get();
+    }
+
+    VSQLITE_CHECK(Count(file) == 100);
+
+}
\ No newline at end of file
@@ -0,0 +1,171 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#include "Test.h"
+
+#include <Vsqlite/Backup.h>
+
+#include <vector>
+#include <chrono>
+#include <stdexcept>
+#include <cstdint>
+
+using namespace Vsqlite;
+using namespace Vsqlite::Tests;
+
+namespace {
+
+    void Populate(Database& db, const std::int64_t rows) {
+        db.Execute("CREATE TABLE t(Value INTEGER, Padding BLOB);");
+        db.PrepareStatement(
+            "WITH RECURSIVE n(i) AS (SELECT 1 UNION ALL SELECT i + 1 FROM n WHERE i < ?1) "
+            "INSERT INTO t SELECT i, zeroblob(200) FROM n WHERE i <= ?1;",
+            0
+        ).Execute(rows);
+    }
+
+    std::int64_t Sum(Database& db) {
+        std::int64_t sum = -1;
+        db.Execute("SELECT coalesce(sum(Value), 0) FROM t;").Fetch(sum);
+        return sum;
+    }
+
+}
+
+VSQLITE_TEST(Backup, StepsIntoAnotherDatabase) {
+
+    Database source = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    Populate(source, 1000);
+
+    Database destination = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    destination.Execute("CREATE TABLE stale(Value INTEGER);");
+
+    Backup backup = { destination, source };
+    VSQLITE_CHECK(!backup.IsDone());
+
+    VSQLITE_CHECK(!backup.Step(1));
+    const BackupProgress first = backup.GetProgress();
+    VSQLITE_CHECK(first.PageCount > 4);
+    VSQLITE_CHECK(first.Remaining == (first.PageCount - 1));
+
+    std::vector<BackupProgress> progress = { };
+    backup.Run(BackupOptions {
+        .PagesPerStep = 4,
+        .StepDelay = std::chrono::milliseconds(0),
+        .OnProgress = [&progress] (const BackupProgress& p) { progress.push_back(p); }
+    });
+
+    VSQLITE_CHECK(backup.IsDone());
+    VSQLITE_CHECK(backup.Step(4));
+    VSQLITE_CHECK(progress.size() == static_cast<std::size_t>((first.Remaining + 3) / 4));
+
+    for (std::size_t i = 1; i < progress.size(); ++i)
+        VSQLITE_CHECK(progress[i].Remaining < progress[i - 1].Remaining);
+
+    VSQLITE_CHECK(progress.back().Remaining == 0);
+    VSQLITE_CHECK(progress.back().GetFraction() == 1.00);
+
+    backup.Finish();
+    backup.Finish();
+    VSQLITE_CHECK_THROWS(backup.Step(1), std::logic_error);
+    VSQLITE_CHECK_THROWS(backup.Run(), std::logic_error);
+
+    // The destination's previous contents are replaced.
+    VSQLITE_CHECK(Sum(destination) == 500500);
+    VSQLITE_CHECK_THROWS(destination.Execute("SELECT * FROM stale;"), SqliteException);
+
+}
+
+VSQLITE_TEST(Backup, ToFileAndToMemory) {
+
+    const TemporaryFile file = TemporaryFile("backup_to_file");
+
+    Database source = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    Populate(source, 100);
+
+    Backup::ToFile(source, file.GetPath(), BackupOptions { .PagesPerStep = -1 });
+
+    Database copy = { file.GetPath(), SQLITE_OPEN_READONLY };
+    VSQLITE_CHECK(Sum(copy) == 5050);
+
+    Database memory = Backup::ToMemory(copy);
+    VSQLITE_CHECK(Sum(memory) == 5050);
+
+    VSQLITE_CHECK_THROWS(Backup::ToFile(source, ""), std::invalid_argument);
+
+}
+
+VSQLITE_TEST(Backup, TimesOutWhileDestinationIsBusy) {
+
+    const TemporaryFile file = TemporaryFile("backup_busy");
+
+    Database source = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    Populate(source, 100);
+
+    Database destination = { file.GetPath(), (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    Database writer = { file.GetPath(), SQLITE_OPEN_READWRITE };
+    writer.Execute("CREATE TABLE lock(Value INTEGER);");
+    writer.Execute("BEGIN IMMEDIATE;");
+
+    Backup backup = { destination, source };
+    VSQLITE_CHECK(!backup.Step(-1));
+    VSQLITE_CHECK(!backup.IsDone());
+
+    try {
+        backup.Run(BackupOptions { .BusyTimeout = std::chrono::milliseconds(20) });
+        VSQLITE_CHECK(false);
+    }
+    catch (const SqliteException& ex) {
+        VSQLITE_CHECK(ex.GetErrorCode() == SQLITE_BUSY);
+    }
+
+    // The backup resumes once the lock is released.
+    writer.Execute("COMMIT;");
+    backup.Run();
+    backup.Finish();
+
+    VSQLITE_CHECK(Sum(destination) == 5050);
+
+}
+
+VSQLITE_TEST(Backup, SerializeRoundTrip) {
+
+    const TemporaryFile file = TemporaryFile("backup_serialize");
+
+    Database source = { file.GetPath(), (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    source.Execute("PRAGMA journal_mode = WAL;");
+    Populate(source, 100);
+
+    SerializedDatabase image = source.Serialize();
+    VSQLITE_CHECK(image.GetSize() > 0);
+    VSQLITE_CHECK(static_cast<std::int64_t>(image.GetData().size()) == image.GetSize());
+
+    // A copy through the span overload, opened read-only.
+    Database readOnly = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    readOnly.Deserialize(image.GetData(), "main", true);
+    VSQLITE_CHECK(Sum(readOnly) == 5050);
+    VSQLITE_CHECK_THROWS(readOnly.Execute("INSERT INTO t VALUES (1, NULL);"), SqliteException);
+
+    // The image itself, taken over by a writable in-memory database.
+    Database memory = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    memory.Deserialize(std::move(image));
+    VSQLITE_CHECK(image.GetSize() == 0);
+    VSQLITE_CHECK(Sum(memory) == 5050);
+
+    memory.Execute("INSERT INTO t VALUES (1000, NULL);");
+    VSQLITE_CHECK(Sum(memory) == 6050);
+    VSQLITE_CHECK(!memory.SerializeNoCopy().empty());
+
+    // And back again: the modified image round-trips into a third connection.
+    Database copy = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    copy.Deserialize(memory.Serialize());
+    VSQLITE_CHECK(Sum(copy) == 6050);
+    VSQLITE_CHECK(Sum(source) == 5050);
+
+    VSQLITE_CHECK_THROWS(source.Serialize("missing"), std::invalid_argument);
+    VSQLITE_CHECK_THROWS(source.Serialize(""), std::invalid_argument);
+
+}
\ No newline at end of file
@@ -0,0 +1,149 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#include "Test.h"
+
+#include <Vsqlite/BlobStream.h>
+
+#include <array>
+#include <string>
+#include <span>
+#include <stdexcept>
+#include <cstdint>
+#include <cstddef>
+
+using namespace Vsqlite;
+using namespace Vsqlite::Tests;
+
+namespace {
+
+    Database OpenBlobs(void) {
+        Database db = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+        db.Execute("CREATE TABLE blobs(Id INTEGER PRIMARY KEY, Data BLOB);");
+        db.Execute("INSERT INTO blobs VALUES (1, x'0001020304050607'), (2, x'AABBCC'), (3, zeroblob(0)), (4, 42);");
+        return db;
+    }
+
+    std::string Hex(Database& db, const std::int64_t rowid) {
+        std::string hex = { };
+        Statement statement = db.PrepareStatement("SELECT hex(Data) FROM blobs WHERE Id = ?;", 0);
+        statement.Execute(rowid);
+        statement.Fetch(hex);
+        return hex;
+    }
+
+}
+
+VSQLITE_TEST(BlobStream, ReadsUpToTheEnd) {
+
+    Database db = OpenBlobs();
+    BlobStream stream = { db, "blobs", "Data", 1, false };
+    VSQLITE_CHECK(stream.GetSize() == 8);
+
+    std::array<std::byte, 5> buffer = { };
+    VSQLITE_CHECK(stream.Read(buffer) == 5);
+    VSQLITE_CHECK(buffer[4] == std::byte { 0x04 });
+    VSQLITE_CHECK(stream.GetPosition() == 5);
+
+    // Only three bytes remain: the read is cut short instead of failing.
+    buffer.fill(std::byte { 0xFF });
+    VSQLITE_CHECK(stream.Read(buffer) == 3);
+    VSQLITE_CHECK(buffer[0] == std::byte { 0x05 });
+    VSQLITE_CHECK(buffer[2] == std::byte { 0x07 });
+    VSQLITE_CHECK(buffer[3] == std::byte { 0xFF });
+    VSQLITE_CHECK(stream.GetPosition() == 8);
+
+    VSQLITE_CHECK(stream.Read(buffer) == 0);
+    VSQLITE_CHECK(stream.Read(std::span<std::byte>()) == 0);
+
+}
+
+VSQLITE_TEST(BlobStream, ReadAtAndSeekCheckBounds) {
+
+    Database db = OpenBlobs();
+    BlobStream stream = { db, "blobs", "Data", 1, false };
+
+    std::array<std::byte, 2> buffer = { };
+    stream.ReadAt(buffer, 6);
+    VSQLITE_CHECK(buffer[1] == std::byte { 0x07 });
+    VSQLITE_CHECK(stream.GetPosition() == 0);
+
+    stream.ReadAt(std::span<std::byte>(), 8);
+    VSQLITE_CHECK_THROWS(stream.ReadAt(buffer, 7), std::out_of_range);
+    VSQLITE_CHECK_THROWS(stream.ReadAt(buffer, -1), std::out_of_range);
+
+    stream.Seek(8);
+    VSQLITE_CHECK(stream.Read(buffer) == 0);
+    stream.Seek(0);
+    VSQLITE_CHECK(stream.Read(buffer) == 2);
+    VSQLITE_CHECK(buffer[1] == std::byte { 0x01 });
+
+    VSQLITE_CHECK_THROWS(stream.Seek(9), std::out_of_range);
+    VSQLITE_CHECK_THROWS(stream.Seek(-1), std::out_of_range);
+    VSQLITE_CHECK(stream.GetPosition() == 2);
+
+}
+
+VSQLITE_TEST(BlobStream, WritesUpToTheEnd) {
+
+    Database db = OpenBlobs();
+
+    {
+        BlobStream stream = { db, "blobs", "Data", 1, true };
+
+        const std::array<std::byte, 3> data = { std::byte { 0xA0 }, std::byte { 0xA1 }, std::byte { 0xA2 } };
+        stream.Seek(5);
+        stream.Write(data);
+        VSQLITE_CHECK(stream.GetPosition() == 8);
+
+        // A write past the end fails without changing the BLOB or the position.
+        VSQLITE_CHECK_THROWS(stream.Write(data), std::out_of_range);
+        VSQLITE_CHECK_THROWS(stream.WriteAt(data, 6), std::out_of_range);
+        VSQLITE_CHECK(stream.GetPosition() == 8);
+
+        stream.WriteAt(std::span<const std::byte>(data).first(1), 0);
+        VSQLITE_CHECK(stream.GetPosition() == 8);
+    }
+
+    VSQLITE_CHECK(Hex(db, 1) == "A001020304A0A1A2");
+
+    BlobStream stream = { db, "blobs", "Data", 1, false };
+    VSQLITE_CHECK_THROWS(stream.WriteAt(std::array<std::byte, 1> { }, 0), SqliteException);
+
+}
+
+VSQLITE_TEST(BlobStream, ReopensOnAnotherRow) {
+
+    Database db = OpenBlobs();
+    BlobStream stream = { db, "blobs", "Data", 1, true };
+
+    std::array<std::byte, 4> buffer = { };
+    VSQLITE_CHECK(stream.Read(buffer) == 4);
+
+    stream.Reopen(2);
+    VSQLITE_CHECK(stream.GetSize() == 3);
+    VSQLITE_CHECK(stream.GetPosition() == 0);
+    VSQLITE_CHECK(stream.Read(buffer) == 3);
+    VSQLITE_CHECK(buffer[0] == std::byte { 0xAA });
+    VSQLITE_CHECK(buffer[2] == std::byte { 0xCC });
+
+    stream.WriteAt(std::array<std::byte, 1> { std::byte { 0x11 } }, 2);
+    VSQLITE_CHECK(Hex(db, 2) == "AABB11");
+
+    stream.Reopen(3);
+    VSQLITE_CHECK(stream.GetSize() == 0);
+    VSQLITE_CHECK(stream.Read(buffer) == 0);
+
+    // An integer cannot be opened as a BLOB, and a missing row cannot be opened at all.
+    // A failed reopen leaves the stream empty rather than sized for the previous row.
+    stream.Reopen(1);
+    VSQLITE_CHECK_THROWS(stream.Reopen(4), SqliteException);
+    VSQLITE_CHECK(stream.GetSize() == 0);
+    VSQLITE_CHECK(stream.Read(buffer) == 0);
+    VSQLITE_CHECK_THROWS(stream.Reopen(5), SqliteException);
+    VSQLITE_CHECK_THROWS(BlobStream(db, "blobs", "Data", 5, false), SqliteException);
+
+}
\ No newline at end of file
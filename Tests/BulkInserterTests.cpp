@@ -0,0 +1,165 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#include "Test.h"
+
+#include <Vsqlite/BulkInserter.h>
+
+#include <string>
+#include <vector>
+#include <tuple>
+#include <optional>
+#include <stdexcept>
+#include <cstdint>
+
+using namespace Vsqlite;
+using namespace Vsqlite::Tests;
+
+namespace {
+
+    struct Pair {
+        std::int64_t A;
+        std::int64_t B;
+    };
+
+    std::int64_t Count(Database& db) {
+        std::int64_t count = -1;
+        db.Execute("SELECT count(*) FROM t;").Fetch(count);
+        return count;
+    }
+
+    bool InTransaction(const Database& db) {
+        return (sqlite3_get_autocommit(db.GetDatabaseHandle()) == 0);
+    }
+
+}
+
+VSQLITE_MAP(Pair, A, B);
+
+VSQLITE_TEST(BulkInserter, RebindsOnlyWhenEveryParameterIsBound) {
+
+    Database db = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    db.Execute("CREATE TABLE t(A INTEGER, B INTEGER);");
+
+    {
+        BulkInserter inserter = { db, "INSERT INTO t VALUES (?1, ?2);" };
+        inserter.Insert(std::int64_t(1), std::int64_t(10));
+        inserter.Insert(Pair { 2, 20 });
+        inserter.Insert(std::make_tuple(std::int64_t(3), std::optional<std::int64_t>()));
+
+        // Fewer arguments than parameters: the remaining parameters are cleared, not left over.
+        inserter.Insert(std::int64_t(4));
+        inserter.Insert(std::int64_t(5), std::int64_t(50));
+        inserter.Insert(std::int64_t(6));
+    }
+
+    std::int64_t nulls = -1;
+    db.Execute("SELECT count(*) FROM t WHERE B IS NULL;").Fetch(nulls);
+    VSQLITE_CHECK(nulls == 3);
+
+    std::int64_t sum = -1;
+    db.Execute("SELECT sum(A) + coalesce(sum(B), 0) FROM t;").Fetch(sum);
+    VSQLITE_CHECK(sum == 101);
+
+}
+
+VSQLITE_TEST(BulkInserter, CommitsAtBatchBoundaries) {
+
+    Database db = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    db.Execute("CREATE TABLE t(Value INTEGER);");
+
+    BulkInserter inserter = { db, "INSERT INTO t VALUES (?);", BulkInsertOptions { .RowsPerTransaction = 3 } };
+    VSQLITE_CHECK(!InTransaction(db));
+
+    for (std::int64_t i = 1; i <= 7; ++i) {
+        inserter.Insert(i);
+        VSQLITE_CHECK(InTransaction(db) == ((i % 3) != 0));
+        VSQLITE_CHECK(inserter.GetStatistics().Transactions == static_cast<std::uint64_t>(i / 3));
+    }
+
+    inserter.Commit();
+    VSQLITE_CHECK(!InTransaction(db));
+    VSQLITE_CHECK(Count(db) == 7);
+
+    const BulkInsertStatistics statistics = inserter.GetStatistics();
+    VSQLITE_CHECK(statistics.Rows == 7);
+    VSQLITE_CHECK(statistics.Transactions == 3);
+    VSQLITE_CHECK(statistics.Bytes == 0);
+
+    VSQLITE_CHECK_THROWS(BulkInserter(db, "INSERT INTO t VALUES (?);", BulkInsertOptions { .RowsPerTransaction = 0 }), std::invalid_argument);
+
+}
+
+VSQLITE_TEST(BulkInserter, CommitsAtByteBoundaries) {
+
+    Database db = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    db.Execute("CREATE TABLE t(Value TEXT);");
+
+    const std::vector<std::string> rows = std::vector<std::string>(10, std::string(10, 'x'));
+    const BulkInsertStatistics statistics = db.InsertMany(
+        "INSERT INTO t VALUES (?);",
+        rows,
+        BulkInsertOptions { .RowsPerTransaction = 1000, .BytesPerTransaction = 25 }
+    );
+
+    VSQLITE_CHECK(statistics.Rows == 10);
+    VSQLITE_CHECK(statistics.Bytes == 100);
+    VSQLITE_CHECK(statistics.Transactions == 4);
+    VSQLITE_CHECK(Count(db) == 10);
+
+}
+
+VSQLITE_TEST(BulkInserter, RollsBackPendingRowsDuringUnwinding) {
+
+    Database db = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    db.Execute("CREATE TABLE t(Value INTEGER UNIQUE);");
+
+    try {
+        BulkInserter inserter = { db, "INSERT INTO t VALUES (?);", BulkInsertOptions { .RowsPerTransaction = 3 } };
+        for (std::int64_t i = 1; i <= 5; ++i) inserter.Insert(i);
+        throw std::runtime_error("abort");
+    }
+    catch (const std::runtime_error&) { }
+
+    VSQLITE_CHECK(!InTransaction(db));
+    VSQLITE_CHECK(Count(db) == 3);
+
+    // A failing row unwinds through the inserter as well.
+    VSQLITE_CHECK_THROWS(db.InsertMany("INSERT INTO t VALUES (?);", std::vector<std::int64_t> { 10, 11, 1 }), SqliteException);
+    VSQLITE_CHECK(!InTransaction(db));
+    VSQLITE_CHECK(Count(db) == 3);
+
+    // Without an exception, the destructor commits the pending rows.
+    {
+        BulkInserter inserter = { db, "INSERT INTO t VALUES (?);", BulkInsertOptions { .RowsPerTransaction = 3 } };
+        for (std::int64_t i = 20; i < 25; ++i) inserter.Insert(i);
+    }
+
+    VSQLITE_CHECK(!InTransaction(db));
+    VSQLITE_CHECK(Count(db) == 8);
+
+}
+
+VSQLITE_TEST(BulkInserter, JoinsAnOpenTransaction) {
+
+    Database db = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    db.Execute("CREATE TABLE t(Value INTEGER);");
+    db.Execute("BEGIN;");
+
+    const BulkInsertStatistics statistics = db.InsertMany(
+        "INSERT INTO t VALUES (?);",
+        std::vector<std::int64_t> { 1, 2, 3, 4, 5 },
+        BulkInsertOptions { .RowsPerTransaction = 2 }
+    );
+
+    VSQLITE_CHECK(statistics.Rows == 5);
+    VSQLITE_CHECK(statistics.Transactions == 0);
+    VSQLITE_CHECK(InTransaction(db));
+
+    db.Execute("ROLLBACK;");
+    VSQLITE_CHECK(Count(db) == 0);
+
+}
\ No newline at end of file
@@ -0,0 +1,78 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#include "Test.h"
+
+#include <Vsqlite/ColumnBuffers.h>
+#include <Vsqlite/Script.h>
+
+#include <string>
+#include <limits>
+#include <cstdint>
+#include <cstddef>
+
+using namespace Vsqlite;
+using namespace Vsqlite::Tests;
+
+namespace {
+
+    Database OpenThreeRows(void) {
+        Database db = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+        db.ExecuteScript("CREATE TABLE t(Value INTEGER, Name TEXT); INSERT INTO t VALUES (1, 'a'), (2, NULL), (3, 'c');");
+        return db;
+    }
+
+}
+
+VSQLITE_TEST(ColumnBuffers, FetchBatchStopsWhenDone) {
+
+    Database db = OpenThreeRows();
+    Statement s = db.PrepareStatement("SELECT Value, Name FROM t ORDER BY Value;", 0);
+    ColumnBuffers<std::int64_t, std::string> buffers = { };
+
+    std::size_t total = 0;
+    std::size_t calls = 0;
+    std::size_t count = 0;
+
+    while (((count = s.FetchBatch(2, buffers)) != 0) && (calls < 10)) {
+        total += count;
+        ++calls;
+    }
+
+    VSQLITE_CHECK(total == 3);
+    VSQLITE_CHECK(calls == 2);
+    VSQLITE_CHECK(buffers.GetRowCount() == 0);
+
+    // The latch holds until the statement is reset.
+    VSQLITE_CHECK(s.FetchBatch(2, buffers) == 0);
+    s.Reset();
+    VSQLITE_CHECK(s.FetchBatch(2, buffers) == 2);
+    VSQLITE_CHECK(buffers.GetColumn<0>()[1] == 2);
+    VSQLITE_CHECK(buffers.IsNull<1>(1));
+
+}
+
+VSQLITE_TEST(ColumnBuffers, FetchBatchOfEmptyResult) {
+
+    Database db = OpenThreeRows();
+    Statement s = db.PrepareStatement("SELECT Value, Name FROM t WHERE Value > 10;", 0);
+    ColumnBuffers<std::int64_t, std::string> buffers = { };
+
+    VSQLITE_CHECK(s.FetchBatch(4, buffers) == 0);
+    VSQLITE_CHECK(s.FetchBatch(4, buffers) == 0);
+
+}
+
+VSQLITE_TEST(ColumnBuffers, FetchBatchWithUnboundedCount) {
+
+    Database db = OpenThreeRows();
+    Statement s = db.PrepareStatement("SELECT Value, Name FROM t;", 0);
+    ColumnBuffers<std::int64_t, std::string> buffers = { };
+
+    VSQLITE_CHECK(s.FetchBatch(std::numeric_limits<std::size_t>::max(), buffers) == 3);
+    VSQLITE_CHECK(s.FetchBatch(std::numeric_limits<std::size_t>::max(), buffers) == 0);
+
+}
\ No newline at end of file
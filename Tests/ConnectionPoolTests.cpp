@@ -0,0 +1,155 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#include "Test.h"
+
+#include <Vsqlite/ConnectionPool.h>
+
+#include <vector>
+#include <optional>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#include <thread>
+#include <utility>
+#include <cstdint>
+
+using namespace Vsqlite;
+using namespace Vsqlite::Tests;
+
+VSQLITE_TEST(ConnectionPool, WriterLeaseReleasedOnAnotherThread) {
+
+    const TemporaryFile file = TemporaryFile("pool_writer_thread");
+    ConnectionPool pool = { file.GetPath() };
+
+    ConnectionLease lease = pool.AcquireWriter();
+    lease->Execute("CREATE TABLE t(Value INTEGER);");
+
+    std::atomic<bool> acquired = false;
+    std::thread waiter = std::thread([&pool, &acquired] () {
+        ConnectionLease writer = pool.AcquireWriter();
+        acquired = true;
+    });
+
+    // The lease moves to another thread, which releases it.
+    std::thread releaser = std::thread([lease = std::move(lease)] () mutable {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        lease->Execute("INSERT INTO t VALUES (1);");
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    VSQLITE_CHECK(!acquired);
+
+    releaser.join();
+    waiter.join();
+    VSQLITE_CHECK(acquired);
+
+    ConnectionLease writer = pool.AcquireWriter();
+    std::int64_t count = 0;
+    writer->Execute("SELECT count(*) FROM t;").Fetch(count);
+    VSQLITE_CHECK(count == 1);
+
+}
+
+VSQLITE_TEST(ConnectionPool, WalSwitchWaitsForLock) {
+
+    const TemporaryFile file = TemporaryFile("pool_busy_open");
+
+    Database other = { file.GetPath(), (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    other.Execute("CREATE TABLE t(Value INTEGER);");
+    other.Execute("BEGIN EXCLUSIVE;");
+
+    std::thread unlocker = std::thread([&other] () {
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        other.Execute("COMMIT;");
+    });
+
+    bool opened = false;
+
+    try {
+        ConnectionPool pool = { file.GetPath() };
+        opened = true;
+    }
+    catch (...) {
+        unlocker.join();
+        throw;
+    }
+
+    unlocker.join();
+    VSQLITE_CHECK(opened);
+
+}
+
+VSQLITE_TEST(ConnectionPool, AcquireReadersIsAllOrNothing) {
+
+    const TemporaryFile file = TemporaryFile("pool_readers");
+    ConnectionPool pool = { file.GetPath(), ConnectionPoolOptions { .Readers = 2 } };
+
+    VSQLITE_CHECK_THROWS(static_cast<void>(pool.AcquireReaders(0)), std::invalid_argument);
+    VSQLITE_CHECK_THROWS(static_cast<void>(pool.AcquireReaders(3)), std::invalid_argument);
+
+    std::optional<ConnectionLease> held = pool.AcquireReader();
+
+    std::atomic<bool> acquired = false;
+    std::thread waiter = std::thread([&pool, &acquired] () {
+        const std::vector<ConnectionLease> leases = pool.AcquireReaders(2);
+        acquired = true;
+    });
+
+    // The idle reader is reserved for the waiter, which does not lease it until the other one is returned.
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    VSQLITE_CHECK(!acquired);
+    VSQLITE_CHECK(!pool.TryAcquireReader().has_value());
+
+    held.reset();
+    waiter.join();
+    VSQLITE_CHECK(acquired);
+    VSQLITE_CHECK(pool.AcquireReaders(2).size() == 2);
+
+}
+
+
+VSQLITE_TEST(ConnectionPool, ReaderWaitersAreServedInOrder) {
+
+    const TemporaryFile file = TemporaryFile("pool_readers_fifo");
+    ConnectionPool pool = { file.GetPath(), ConnectionPoolOptions { .Readers = 2 } };
+
+    std::optional<ConnectionLease> held = pool.AcquireReader();
+
+    std::mutex mutex;
+    std::vector<std::int32_t> order = { };
+    const auto served = [&mutex, &order] (const std::int32_t id) {
+        const std::lock_guard<std::mutex> lock(mutex);
+        order.push_back(id);
+    };
+
+    std::thread large = std::thread([&pool, &served] () {
+        const std::vector<ConnectionLease> leases = pool.AcquireReaders(2);
+        served(1);
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    // A reader is idle, but it is reserved for the request that has waited longer.
+    std::thread small = std::thread([&pool, &served] () {
+        const ConnectionLease lease = pool.AcquireReader();
+        served(2);
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    {
+        const std::lock_guard<std::mutex> lock(mutex);
+        VSQLITE_CHECK(order.empty());
+    }
+
+    held.reset();
+    large.join();
+    small.join();
+
+    VSQLITE_CHECK(order == std::vector<std::int32_t>({ 1, 2 }));
+    VSQLITE_CHECK(pool.TryAcquireReader().has_value());
+
+}
\ No newline at end of file
@@ -0,0 +1,144 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#include "Test.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <span>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+using namespace Vsqlite;
+using namespace Vsqlite::Tests;
+
+namespace {
+
+    Database OpenMemory(void) {
+        return Database(":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE));
+    }
+
+}
+
+VSQLITE_TEST(DataBinding, BorrowedTextIsNotCopied) {
+
+    Database db = OpenMemory();
+    const std::string text = "borrowed text";
+
+    Statement s = db.PrepareStatement("SELECT ?;", 0);
+    s.Bind(Borrowed(text));
+    s.Step();
+
+    // SELECT ? returns the bound value itself, so a borrowed value points into the caller's buffer.
+    // sqlite3_column_text would copy it to add a terminator; sqlite3_column_blob does not.
+    const void* pText = sqlite3_column_blob(s.GetStatementHandle(), 0);
+    VSQLITE_CHECK(pText == static_cast<const void*>(text.data()));
+    VSQLITE_CHECK(sqlite3_column_bytes(s.GetStatementHandle(), 0) == static_cast<int>(text.length()));
+
+}
+
+VSQLITE_TEST(DataBinding, BorrowedTextSeesLaterWrites) {
+
+    Database db = OpenMemory();
+    std::string text = "before";
+
+    Statement s = db.PrepareStatement("SELECT ?;", 0);
+    s.Bind(Borrowed(text));
+
+    // A copy would still hold "before".
+    std::memcpy(text.data(), "after!", 6);
+
+    std::string value = { };
+    VSQLITE_CHECK(s.Fetch(value));
+    VSQLITE_CHECK(value == "after!");
+
+}
+
+VSQLITE_TEST(DataBinding, BorrowedBlobIsNotCopied) {
+
+    Database db = OpenMemory();
+    const std::vector<std::byte> blob = { std::byte { 1 }, std::byte { 2 }, std::byte { 3 } };
+
+    Statement s = db.PrepareStatement("SELECT ?;", 0);
+    s.Bind(Borrowed(blob));
+    s.Step();
+
+    VSQLITE_CHECK(sqlite3_column_blob(s.GetStatementHandle(), 0) == static_cast<const void*>(blob.data()));
+
+}
+
+VSQLITE_TEST(DataBinding, BorrowedCharArrayUsesExtent) {
+
+    Database db = OpenMemory();
+
+    // Without a terminator the whole array is bound; with one, it is excluded.
+    const char unterminated[3] = { 'a', 'b', 'c' };
+    const char terminated[] = "ab\0cd";
+
+    std::string value = { };
+    Statement s = db.PrepareStatement("SELECT ?;", 0);
+
+    s.Bind(Borrowed(unterminated));
+    VSQLITE_CHECK(s.Fetch(value));
+    VSQLITE_CHECK(value == "abc");
+    s.Reset();
+
+    s.Bind(Borrowed(terminated));
+    VSQLITE_CHECK(s.Fetch(value));
+    VSQLITE_CHECK(value == std::string_view("ab\0cd", 5));
+
+}
+
+VSQLITE_TEST(DataBinding, UnterminatedSlicesRoundTrip) {
+
+    Database db = OpenMemory();
+    Statement s = db.PrepareStatement("SELECT ?, length(CAST(? AS BLOB));", 0);
+
+    // The buffer has no terminator anywhere: every byte is a letter, and it is heap-allocated at its
+    // exact size, so AddressSanitizer reports any read past the end of a slice that touches it.
+    constexpr std::size_t Size = 257;
+    std::vector<char> buffer = std::vector<char>(Size);
+    std::uint32_t seed = 12345;
+    const auto next = [&seed] () { seed = ((seed * 1103515245u) + 12345u); return (seed >> 8); };
+
+    for (char& ch : buffer) ch = static_cast<char>('a' + (next() % 26));
+
+    for (std::int32_t i = 0; i < 2000; ++i) {
+
+        const std::size_t offset = (next() % Size);
+        const std::size_t length = (next() % (Size - offset + 1));
+        const std::string_view slice = { (buffer.data() + offset), length };
+
+        std::string text = { };
+        std::int64_t bytes = -1;
+
+        if (i % 2 == 0) s.Bind(slice, slice);
+        else s.Bind(std::string(slice), std::string(slice));
+
+        VSQLITE_CHECK(s.Fetch(text, bytes));
+        VSQLITE_CHECK(text == slice);
+        VSQLITE_CHECK(bytes == static_cast<std::int64_t>(length));
+        s.Reset();
+
+    }
+
+}
+
+VSQLITE_TEST(DataBinding, CharArrayBindsExtent) {
+
+    Database db = OpenMemory();
+    Statement s = db.PrepareStatement("SELECT ?;", 0);
+
+    const char unterminated[4] = { 'w', 'x', 'y', 'z' };
+    std::string value = { };
+
+    s.Bind(unterminated);
+    VSQLITE_CHECK(s.Fetch(value));
+    VSQLITE_CHECK(value == "wxyz");
+
+}
\ No newline at end of file
@@ -0,0 +1,98 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#include "Test.h"
+
+#include <Vsqlite/DatabaseImage.h>
+
+#include <optional>
+#include <cstdint>
+
+using namespace Vsqlite;
+using namespace Vsqlite::Tests;
+
+namespace {
+
+    void CreateReference(const TemporaryFile& file, const std::int64_t rows) {
+        Database db = { file.GetPath(), (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+        db.Execute("CREATE TABLE t(Value INTEGER);");
+        Statement insert = db.PrepareStatement(
+            "WITH RECURSIVE n(i) AS (SELECT 1 UNION ALL SELECT i + 1 FROM n WHERE i < ?1) INSERT INTO t(Value) SELECT i FROM n;", 0);
+        insert.Execute(rows);
+    }
+
+}
+
+VSQLITE_TEST(DatabaseImage, QueriesMappedAndReadImages) {
+
+    const TemporaryFile file = TemporaryFile("image_query");
+    CreateReference(file, 1000);
+
+    for (const ImageLoadMode mode : { ImageLoadMode::Map, ImageLoadMode::Read }) {
+
+        Database db = Database::OpenImage(file.GetPath(), ImageOptions { .Mode = mode });
+        VSQLITE_CHECK(db.GetImage() != nullptr);
+        VSQLITE_CHECK(db.GetImage()->GetStatistics().Mapped == (mode == ImageLoadMode::Map));
+        VSQLITE_CHECK(db.GetImage()->GetData().size() == static_cast<std::size_t>(db.GetImage()->GetStatistics().Bytes));
+
+        std::int64_t sum = 0;
+        db.Execute("SELECT sum(Value) FROM t;").Fetch(sum);
+        VSQLITE_CHECK(sum == 500500);
+
+    }
+
+}
+
+VSQLITE_TEST(DatabaseImage, RejectsWrites) {
+
+    const TemporaryFile file = TemporaryFile("image_readonly");
+    CreateReference(file, 10);
+
+    Database db = Database::OpenImage(file.GetPath());
+    VSQLITE_CHECK_THROWS(db.Execute("INSERT INTO t VALUES (1);"), SqliteException);
+    VSQLITE_CHECK_THROWS(db.Execute("CREATE TABLE u(x);"), SqliteException);
+
+    std::int64_t count = 0;
+    db.Execute("SELECT count(*) FROM t;").Fetch(count);
+    VSQLITE_CHECK(count == 10);
+
+}
+
+VSQLITE_TEST(DatabaseImage, PrefetchWithMoreThreadsThanPages) {
+
+    const TemporaryFile file = TemporaryFile("image_prefetch");
+    CreateReference(file, 10);
+
+    DatabaseImage image = { file.GetPath(), ImageLoadMode::Map };
+    const std::size_t pages = ((image.GetData().size() + 4095) / 4096);
+    image.Prefetch(pages + 16);
+    VSQLITE_CHECK_THROWS(image.Prefetch(0), std::invalid_argument);
+
+    Database db = Database::OpenImage(file.GetPath(), ImageOptions { .Mode = ImageLoadMode::Map, .PrefetchThreads = 64 });
+    std::int64_t count = 0;
+    db.Execute("SELECT count(*) FROM t;").Fetch(count);
+    VSQLITE_CHECK(count == 10);
+
+}
+
+VSQLITE_TEST(DatabaseImage, OutlivesDatabaseWhileStatementsRemain) {
+
+    const TemporaryFile file = TemporaryFile("image_zombie");
+    CreateReference(file, 1000);
+
+    // Destroying the database leaves the connection open until the statement is finalized,
+    // and the image must stay mapped until then.
+    std::optional<Statement> select = std::nullopt;
+    {
+        Database db = Database::OpenImage(file.GetPath());
+        select.emplace(db.PrepareStatement("SELECT sum(Value) FROM t;", 0));
+    }
+
+    std::int64_t sum = 0;
+    VSQLITE_CHECK(select->Fetch(sum));
+    VSQLITE_CHECK(sum == 500500);
+
+}
\ No newline at end of file
@@ -0,0 +1,115 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#include "Test.h"
+
+#include <Vsqlite/StatementCache.h>
+#include <Vsqlite/Transaction.h>
+
+#include <string>
+#include <chrono>
+#include <thread>
+#include <cstdint>
+
+using namespace Vsqlite;
+using namespace Vsqlite::Tests;
+
+VSQLITE_TEST(Database, ExecuteAndFetch) {
+
+    Database db = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    db.Execute("CREATE TABLE t(Id INTEGER PRIMARY KEY, Name TEXT NOT NULL);");
+
+    Statement insert = db.PrepareStatement("INSERT INTO t(Name) VALUES (?);", 0);
+    insert.Execute("a");
+    insert.Execute("b");
+
+    std::int64_t count = 0;
+    db.Execute("SELECT count(*) FROM t;").Fetch(count);
+    VSQLITE_CHECK(count == 2);
+
+    std::string name = { };
+    Statement select = db.PrepareStatement("SELECT Name FROM t WHERE Id = ?;", 0);
+    select.Bind(2);
+    VSQLITE_CHECK(select.Fetch(name));
+    VSQLITE_CHECK(name == "b");
+    VSQLITE_CHECK(!select.Fetch(name));
+
+}
+
+VSQLITE_TEST(Database, InvalidSqlThrows) {
+    Database db = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    VSQLITE_CHECK_THROWS(db.Execute("SELECT * FROM missing;"), SqliteException);
+}
+
+VSQLITE_TEST(Database, TransactionRollsBackOnDestruction) {
+
+    Database db = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    db.Execute("CREATE TABLE t(Value INTEGER);");
+
+    {
+        Transaction transaction = { db };
+        db.Execute("INSERT INTO t VALUES (1);");
+    }
+
+    std::int64_t count = -1;
+    db.Execute("SELECT count(*) FROM t;").Fetch(count);
+    VSQLITE_CHECK(count == 0);
+
+}
+
+VSQLITE_TEST(StatementCache, ReusesAndEvicts) {
+
+    Database db = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    StatementCache& cache = db.GetStatementCache();
+    cache.SetCapacity(2);
+
+    std::int64_t value = 0;
+    db.Cached("SELECT 1;")->Fetch(value);
+    db.Cached("SELECT 1;")->Fetch(value);
+    db.Cached("SELECT 2;")->Fetch(value);
+    db.Cached("SELECT 3;")->Fetch(value);
+
+    const StatementCacheStatistics stats = cache.GetStatistics();
+    VSQLITE_CHECK(stats.Hits == 1);
+    VSQLITE_CHECK(stats.Misses == 3);
+    VSQLITE_CHECK(stats.Evictions == 1);
+    VSQLITE_CHECK(stats.Size == 2);
+    VSQLITE_CHECK(value == 3);
+
+}
+
+VSQLITE_TEST(Database, ConfigureWaitsForLockedDatabase) {
+
+    const TemporaryFile file = TemporaryFile("configure_busy");
+
+    Database other = { file.GetPath(), (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    other.Execute("CREATE TABLE t(Value INTEGER);");
+    other.Execute("BEGIN EXCLUSIVE;");
+
+    std::thread unlocker = std::thread([&other] () {
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        other.Execute("COMMIT;");
+    });
+
+    DatabaseOptions options = { };
+    options.Journal = JournalMode::Wal;
+    options.BusyTimeout = 5000;
+
+    bool opened = false;
+
+    try {
+        Database db = { file.GetPath(), SQLITE_OPEN_READWRITE, options };
+        opened = true;
+    }
+    catch (...) {
+        unlocker.join();
+        throw;
+    }
+
+    unlocker.join();
+    VSQLITE_CHECK(opened);
+
+}
\ No newline at end of file
@@ -0,0 +1,69 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#include "Test.h"
+
+#include <Vsqlite/Function.h>
+
+#include <cstdint>
+
+using namespace Vsqlite;
+using namespace Vsqlite::Tests;
+
+static std::int64_t Twice(const std::int64_t value) {
+    return (value * 2);
+}
+
+VSQLITE_TEST(Function, DeterministicIsOptIn) {
+
+    Database db = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    db.RegisterFunction("twice", Twice);
+    db.RegisterFunction("stateless", [] (const std::int64_t value) { return value; });
+    db.RegisterFunction("deterministic_twice", Twice, SQLITE_DETERMINISTIC);
+    db.Execute("CREATE TABLE t(x INTEGER);");
+
+    // Neither a function pointer nor a captureless lambda is assumed to be deterministic.
+    VSQLITE_CHECK_THROWS(db.Execute("CREATE INDEX t_twice ON t(twice(x));"), SqliteException);
+    VSQLITE_CHECK_THROWS(db.Execute("CREATE INDEX t_stateless ON t(stateless(x));"), SqliteException);
+    db.Execute("CREATE INDEX t_deterministic_twice ON t(deterministic_twice(x));");
+
+    std::int64_t value = 0;
+    db.Execute("SELECT deterministic_twice(21);").Fetch(value);
+    VSQLITE_CHECK(value == 42);
+
+}
+
+VSQLITE_TEST(Function, StatefulFunctionIsNotDeterministic) {
+
+    Database db = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    db.RegisterFunction("counter", [count = std::int64_t(0)] () mutable { return ++count; });
+    db.Execute("CREATE TABLE t(x INTEGER);");
+
+    VSQLITE_CHECK_THROWS(db.Execute("CREATE INDEX t_counter ON t(counter());"), SqliteException);
+
+    std::int64_t first = 0;
+    std::int64_t second = 0;
+    db.Execute("SELECT counter(), counter();").Fetch(first, second);
+    VSQLITE_CHECK(first != second);
+
+}
+
+VSQLITE_TEST(Function, InnocuousIsOptIn) {
+
+    Database db = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    db.Execute("PRAGMA trusted_schema = OFF;");
+    db.RegisterFunction("twice", Twice, SQLITE_DETERMINISTIC);
+    db.RegisterFunction("safe_twice", Twice, (SQLITE_DETERMINISTIC | SQLITE_INNOCUOUS));
+    db.Execute("CREATE VIEW v AS SELECT twice(1) AS a;");
+    db.Execute("CREATE VIEW w AS SELECT safe_twice(1) AS a;");
+
+    VSQLITE_CHECK_THROWS(db.Execute("SELECT a FROM v;"), SqliteException);
+
+    std::int64_t value = 0;
+    db.Execute("SELECT a FROM w;").Fetch(value);
+    VSQLITE_CHECK(value == 2);
+
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#include "Test.h"
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <exception>
+#include <cstdint>
+
+using namespace Vsqlite::Tests;
+
+static void PrintUsage(const char* program) {
+    std::cout << "Usage: " << program << " [--filter=<prefix>] [--list]" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+
+    std::string_view filter = { };
+    bool list = false;
+
+    for (int i = 1; i < argc; ++i) {
+
+        const std::string_view arg = argv[i];
+
+        if (arg.starts_with("--filter=")) filter = arg.substr(9);
+        else if (arg == "--list") list = true;
+        else {
+            PrintUsage(argv[0]);
+            return ((arg == "--help") ? 0 : 1);
+        }
+
+    }
+
+    std::int32_t passed = 0;
+    std::int32_t failed = 0;
+
+    for (const TestInfo& test : GetRegistry()) {
+
+        if (!filter.empty() && !test.Name.starts_with(filter)) continue;
+
+        if (list) {
+            std::cout << test.Name << std::endl;
+            continue;
+        }
+
+        try {
+            test.Function();
+            std::cout << "[ PASS ] " << test.Name << std::endl;
+            ++passed;
+        }
+        catch (const std::exception& ex) {
+            std::cout << "[ FAIL ] " << test.Name << ": " << ex.what() << std::endl;
+            ++failed;
+        }
+
+    }
+
+    if (!list) std::cout << passed << " passed, " << failed << " failed." << std::endl;
+
+    return ((failed == 0) ? 0 : 1);
+}
\ No newline at end of file
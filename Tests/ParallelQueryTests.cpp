@@ -0,0 +1,162 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#include "Test.h"
+
+#include <Vsqlite/ParallelQuery.h>
+
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <limits>
+#include <stdexcept>
+#include <cstdint>
+#include <cstddef>
+
+using namespace Vsqlite;
+using namespace Vsqlite::Tests;
+
+namespace {
+
+    constexpr std::string_view SumQuery = "SELECT coalesce(sum(Value), 0) FROM t WHERE rowid BETWEEN ?1 AND ?2;";
+
+    void Populate(ConnectionPool& pool, const std::int64_t rows) {
+        ConnectionLease writer = pool.AcquireWriter();
+        writer->Execute("CREATE TABLE t(Value INTEGER);");
+        Statement insert = writer->PrepareStatement(
+            "WITH RECURSIVE n(i) AS (SELECT 1 UNION ALL SELECT i + 1 FROM n WHERE i < ?1) INSERT INTO t(Value) SELECT i FROM n WHERE i <= ?1;", 0);
+        insert.Execute(rows);
+    }
+
+    std::int64_t Sum(ParallelQuery& query) {
+        return query.Run<std::int64_t>(
+            0,
+            [] (Statement& s) {
+                std::int64_t sum = 0;
+                s.Fetch(sum);
+                return sum;
+            },
+            [] (const std::int64_t a, const std::int64_t b) { return (a + b); }
+        );
+    }
+
+}
+
+VSQLITE_TEST(ParallelQuery, SplitCoversRange) {
+
+    const auto check = [] (const std::int64_t first, const std::int64_t last, const std::size_t count) {
+        const std::vector<ParallelQueryPartition> partitions = ParallelQuery::Split(first, last, count);
+        VSQLITE_CHECK(partitions.size() == count);
+        VSQLITE_CHECK(partitions.front().Lower == first);
+        VSQLITE_CHECK(partitions.back().Upper == last);
+        for (std::size_t i = 1; i < partitions.size(); ++i)
+            VSQLITE_CHECK(partitions[i].Lower == (partitions[i - 1].Upper + 1));
+    };
+
+    check(1, 100, 4);
+    check(0, 1, 4);
+    check(5, 5, 3);
+    check(std::numeric_limits<std::int64_t>::min(), std::numeric_limits<std::int64_t>::max(), 8);
+
+    VSQLITE_CHECK_THROWS(static_cast<void>(ParallelQuery::Split(2, 1, 1)), std::invalid_argument);
+    VSQLITE_CHECK_THROWS(static_cast<void>(ParallelQuery::Split(1, 2, 0)), std::invalid_argument);
+
+}
+
+VSQLITE_TEST(ParallelQuery, SumMatchesSerial) {
+
+    const TemporaryFile file = TemporaryFile("parallel_sum");
+    ConnectionPool pool = { file.GetPath() };
+    Populate(pool, 1000);
+
+    ParallelQuery query = { pool, SumQuery };
+    query.ByRowid("t");
+    VSQLITE_CHECK(Sum(query) == 500500);
+
+    query.ByRange(1, 10);
+    VSQLITE_CHECK(Sum(query) == 55);
+
+}
+
+VSQLITE_TEST(ParallelQuery, EmptyTableReturnsInitial) {
+
+    const TemporaryFile file = TemporaryFile("parallel_empty");
+    ConnectionPool pool = { file.GetPath() };
+    Populate(pool, 0);
+
+    ParallelQuery query = { pool, SumQuery };
+    query.ByRowid("t");
+    VSQLITE_CHECK(query.Run<std::int64_t>(42, [] (Statement&) { return std::int64_t(1); }, [] (std::int64_t a, std::int64_t b) { return (a + b); }) == 42);
+
+}
+
+VSQLITE_TEST(ParallelQuery, MapExceptionsAreRethrown) {
+
+    const TemporaryFile file = TemporaryFile("parallel_error");
+    ConnectionPool pool = { file.GetPath() };
+    Populate(pool, 100);
+
+    ParallelQuery query = { pool, SumQuery };
+    query.ByRowid("t");
+
+    const auto fail = [] (Statement&) -> std::int64_t { throw std::runtime_error("map"); };
+    VSQLITE_CHECK_THROWS(static_cast<void>(query.Run<std::int64_t>(0, fail, [] (std::int64_t a, std::int64_t b) { return (a + b); })), std::runtime_error);
+
+    // The readers were returned to the pool.
+    VSQLITE_CHECK(Sum(query) == 5050);
+
+}
+
+VSQLITE_TEST(ParallelQuery, ConcurrentRunsDoNotDeadlock) {
+
+    const TemporaryFile file = TemporaryFile("parallel_concurrent");
+    ConnectionPool pool = { file.GetPath(), ConnectionPoolOptions { .Readers = 4 } };
+    Populate(pool, 1000);
+
+    // Two queries of three partitions each cannot both hold their readers at once.
+    std::vector<std::thread> threads = { };
+    std::vector<std::int64_t> sums = std::vector<std::int64_t>(2);
+
+    for (std::size_t i = 0; i < sums.size(); ++i) {
+        threads.emplace_back([&pool, &sums, i] () {
+            ParallelQuery query = { pool, SumQuery, ParallelQueryOptions { .Partitions = 3 } };
+            query.ByRowid("t");
+            for (std::int32_t run = 0; run < 50; ++run) sums[i] = Sum(query);
+        });
+    }
+
+    for (std::thread& thread : threads) thread.join();
+
+    VSQLITE_CHECK(sums[0] == 500500);
+    VSQLITE_CHECK(sums[1] == 500500);
+
+}
+
+VSQLITE_TEST(ParallelQuery, WaitingRunHoldsNoReaders) {
+
+    const TemporaryFile file = TemporaryFile("parallel_waiting");
+    ConnectionPool pool = { file.GetPath(), ConnectionPoolOptions { .Readers = 4 } };
+    Populate(pool, 100);
+
+    std::vector<ConnectionLease> held = pool.AcquireReaders(2);
+
+    std::int64_t sum = 0;
+    std::thread runner = std::thread([&pool, &sum] () {
+        ParallelQuery query = { pool, SumQuery, ParallelQueryOptions { .Partitions = 3 } };
+        query.ByRowid("t");
+        sum = Sum(query);
+    });
+
+    // The run waits for a third reader without leasing the two idle ones; they are only reserved for it.
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    const bool idle = pool.TryAcquireReader().has_value();
+
+    held.clear();
+    runner.join();
+    VSQLITE_CHECK(!idle);
+    VSQLITE_CHECK(sum == 5050);
+
+}
\ No newline at end of file
@@ -0,0 +1,108 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#include "Test.h"
+
+#include <Vsqlite/QueryProfiler.h>
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+using namespace Vsqlite;
+using namespace Vsqlite::Tests;
+
+VSQLITE_TEST(QueryProfiler, NormalizesLiterals) {
+
+    VSQLITE_CHECK(QueryProfiler::Normalize("SELECT  1, -2.5e-3, 0x1F,\n 'it''s', X'00ff' FROM t;") == "SELECT ?, -?, ?, ?, ? FROM t;");
+    VSQLITE_CHECK(QueryProfiler::Normalize("  SELECT a1 /* note */ FROM \"t 2\" -- trailing\n WHERE b = ?1 AND c = :name  ") == "SELECT a1 FROM \"t 2\" WHERE b = ?1 AND c = :name");
+    VSQLITE_CHECK(QueryProfiler::Normalize("PRAGMA cache_size=-2000;") == "PRAGMA cache_size=-?;");
+    VSQLITE_CHECK(QueryProfiler::Normalize("SELECT [a 1], `b` FROM t2;") == "SELECT [a 1], `b` FROM t2;");
+    VSQLITE_CHECK(QueryProfiler::Normalize("") == "");
+
+}
+
+VSQLITE_TEST(QueryProfiler, GroupsByNormalizedSql) {
+
+    Database db = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    db.Execute("CREATE TABLE t(x INTEGER);");
+
+    QueryProfiler& profiler = db.EnableProfiling(QueryProfilerOptions { .CountRows = true });
+    for (std::int32_t i = 0; i < 10; ++i) db.Execute("INSERT INTO t VALUES (" + std::to_string(i) + ");");
+    db.Execute("SELECT x FROM t ORDER BY x;");
+
+    const std::vector<QueryStatistics> snapshot = profiler.GetSnapshot();
+    VSQLITE_CHECK(snapshot.size() == 2);
+
+    for (std::size_t i = 1; i < snapshot.size(); ++i)
+        VSQLITE_CHECK(snapshot[i - 1].TotalTime >= snapshot[i].TotalTime);
+
+    for (const QueryStatistics& stats : snapshot) {
+
+        std::uint64_t histogram = 0;
+        for (const std::uint64_t count : stats.Histogram) histogram += count;
+        VSQLITE_CHECK(histogram == stats.Calls);
+        VSQLITE_CHECK(stats.MinTime <= stats.MaxTime);
+
+        if (stats.Sql == "INSERT INTO t VALUES (?);") VSQLITE_CHECK(stats.Calls == 10);
+        else {
+            // Execute steps once, so only the first row is counted.
+            VSQLITE_CHECK(stats.Sql == "SELECT x FROM t ORDER BY x;");
+            VSQLITE_CHECK((stats.Calls == 1) && (stats.Rows == 1) && (stats.Sorts == 1));
+        }
+
+    }
+
+    profiler.Reset();
+    VSQLITE_CHECK(profiler.GetSnapshot().empty());
+
+}
+
+VSQLITE_TEST(QueryProfiler, CapsDistinctStatements) {
+
+    Database db = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    QueryProfiler& profiler = db.EnableProfiling(QueryProfilerOptions { .MaxStatements = 2 });
+
+    db.Execute("SELECT 1;");
+    db.Execute("SELECT 1, 2;");
+    db.Execute("SELECT 1, 2, 3;");
+    db.Execute("SELECT 1, 2, 3, 4;");
+    db.Execute("SELECT 5;");
+
+    const std::vector<QueryStatistics> snapshot = profiler.GetSnapshot();
+    VSQLITE_CHECK(snapshot.size() == 3);
+
+    for (const QueryStatistics& stats : snapshot) {
+        if (stats.Sql == "SELECT ?;") VSQLITE_CHECK(stats.Calls == 2);
+        else if (stats.Sql == "SELECT ?, ?;") VSQLITE_CHECK(stats.Calls == 1);
+        else VSQLITE_CHECK((stats.Sql == QueryProfiler::OverflowSql) && (stats.Calls == 2));
+    }
+
+}
+
+VSQLITE_TEST(QueryProfiler, ExportsJsonAndPrometheus) {
+
+    Database db = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    QueryProfiler& profiler = db.EnableProfiling();
+
+    VSQLITE_CHECK(profiler.ToJson() == "[]");
+    VSQLITE_CHECK(profiler.ToPrometheus().find("_bucket{") == std::string::npos);
+
+    for (std::int32_t i = 0; i < 3; ++i) db.Execute("SELECT \"a\"\n FROM (SELECT 1 AS a);");
+
+    const std::string json = profiler.ToJson();
+    VSQLITE_CHECK(json.starts_with("[{\"sql\":\"SELECT \\\"a\\\" FROM (SELECT ? AS a);\",\"calls\":3,"));
+    VSQLITE_CHECK(json.find("\"histogram_us\":[") != std::string::npos);
+    VSQLITE_CHECK(json.ends_with("]}]"));
+
+    const std::string prometheus = profiler.ToPrometheus("app");
+    const std::string label = "{sql=\"SELECT \\\"a\\\" FROM (SELECT ? AS a);\"";
+    VSQLITE_CHECK(prometheus.starts_with("# TYPE app_query_duration_seconds histogram\n"));
+    VSQLITE_CHECK(prometheus.find("app_query_duration_seconds_bucket" + label + ",le=\"+Inf\"} 3\n") != std::string::npos);
+    VSQLITE_CHECK(prometheus.find("app_query_duration_seconds_count" + label + "} 3\n") != std::string::npos);
+    VSQLITE_CHECK(prometheus.find("# TYPE app_query_vm_steps_total counter\n") != std::string::npos);
+
+}
\ No newline at end of file
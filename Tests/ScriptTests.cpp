@@ -0,0 +1,122 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#include "Test.h"
+
+#include <Vsqlite/Script.h>
+
+#include <chrono>
+#include <stdexcept>
+#include <cstdint>
+
+using namespace Vsqlite;
+using namespace Vsqlite::Tests;
+
+namespace {
+
+    std::int64_t Count(Database& db, const char* const table) {
+        std::int64_t count = -1;
+        db.Execute(std::string("SELECT count(*) FROM ") + table + ";").Fetch(count);
+        return count;
+    }
+
+}
+
+VSQLITE_TEST(Script, SkipsWhitespaceCommentsAndEmptyStatements) {
+
+    Database db = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+
+    const ScriptResult result = db.ExecuteScript(
+        "  -- schema\n"
+        "CREATE TABLE t(Value INTEGER);;\n"
+        "; /* nothing */ ;\n"
+        "INSERT INTO t VALUES (1), (2);\n"
+        "INSERT INTO t VALUES (3)\n"
+        "\n  -- trailing comment\n /* and a block */ \t\n"
+    );
+
+    VSQLITE_CHECK(result.Statements == 3);
+    VSQLITE_CHECK(result.Changes == 3);
+    VSQLITE_CHECK(result.Timings.empty());
+    VSQLITE_CHECK(Count(db, "t") == 3);
+
+    VSQLITE_CHECK_THROWS(db.ExecuteScript(""), std::invalid_argument);
+
+    const ScriptResult empty = db.ExecuteScript(" ; -- only a comment\n");
+    VSQLITE_CHECK(empty.Statements == 0);
+    VSQLITE_CHECK(empty.Changes == 0);
+
+}
+
+VSQLITE_TEST(Script, AtomicScriptRollsBackOnError) {
+
+    Database db = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    db.Execute("CREATE TABLE t(Value INTEGER UNIQUE);");
+
+    const char* const script =
+        "INSERT INTO t VALUES (1);\n"
+        "CREATE TABLE u(Value INTEGER);\n"
+        "INSERT INTO t VALUES (1);\n"
+        "INSERT INTO t VALUES (2);\n";
+
+    VSQLITE_CHECK_THROWS(db.ExecuteScript(script), SqliteException);
+    VSQLITE_CHECK(sqlite3_get_autocommit(db.GetDatabaseHandle()) != 0);
+    VSQLITE_CHECK(Count(db, "t") == 0);
+    VSQLITE_CHECK_THROWS(db.Execute("SELECT * FROM u;"), SqliteException);
+
+    // Inside a transaction, only the script's savepoint is rolled back.
+    db.Execute("BEGIN;");
+    db.Execute("INSERT INTO t VALUES (5);");
+    VSQLITE_CHECK_THROWS(db.ExecuteScript(script), SqliteException);
+    VSQLITE_CHECK(sqlite3_get_autocommit(db.GetDatabaseHandle()) == 0);
+    db.Execute("COMMIT;");
+    VSQLITE_CHECK(Count(db, "t") == 1);
+
+    // Without Atomic, the statements before the failing one stay.
+    db.Execute("DELETE FROM t;");
+    VSQLITE_CHECK_THROWS(db.ExecuteScript(script, ScriptOptions { .Atomic = false }), SqliteException);
+    VSQLITE_CHECK(Count(db, "t") == 1);
+    VSQLITE_CHECK(Count(db, "u") == 0);
+
+}
+
+VSQLITE_TEST(Script, RecordsPerStatementTimings) {
+
+    Database db = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+
+    const ScriptResult result = db.ExecuteScript(
+        "CREATE TABLE t(Value INTEGER);\n"
+        "  -- three rows\n"
+        "  INSERT INTO t VALUES (1), (2), (3);  \n"
+        ";\n"
+        "SELECT * FROM t;\n"
+        "DELETE FROM t WHERE Value > 1;",
+        ScriptOptions { .Timings = true }
+    );
+
+    VSQLITE_CHECK(result.Statements == 4);
+    VSQLITE_CHECK(result.Changes == 5);
+    VSQLITE_CHECK(result.Timings.size() == 4);
+
+    VSQLITE_CHECK(result.Timings[0].Sql == "CREATE TABLE t(Value INTEGER);");
+    VSQLITE_CHECK(result.Timings[1].Sql == "-- three rows\n  INSERT INTO t VALUES (1), (2), (3);");
+    VSQLITE_CHECK(result.Timings[2].Sql == "SELECT * FROM t;");
+    VSQLITE_CHECK(result.Timings[3].Sql == "DELETE FROM t WHERE Value > 1;");
+
+    VSQLITE_CHECK(result.Timings[0].Changes == 0);
+    VSQLITE_CHECK(result.Timings[1].Changes == 3);
+    VSQLITE_CHECK(result.Timings[2].Changes == 0);
+    VSQLITE_CHECK(result.Timings[3].Changes == 2);
+
+    std::chrono::nanoseconds total = { };
+    for (const ScriptStatementTiming& timing : result.Timings) {
+        VSQLITE_CHECK(timing.Elapsed.count() >= 0);
+        total += timing.Elapsed;
+    }
+
+    VSQLITE_CHECK(result.Elapsed >= total);
+
+}
\ No newline at end of file
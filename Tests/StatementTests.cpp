@@ -0,0 +1,113 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#include "Test.h"
+
+#include <Vsqlite/RowMapping.h>
+
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include <cstddef>
+
+using namespace Vsqlite;
+using namespace Vsqlite::Tests;
+
+VSQLITE_TEST(Statement, ColumnViewsPointIntoRowBuffer) {
+
+    Database db = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    Statement s = db.PrepareStatement("SELECT 'first' UNION ALL SELECT 'second';", 0);
+
+    std::string_view view = { };
+    VSQLITE_CHECK(s.Fetch(view));
+    VSQLITE_CHECK(view == "first");
+
+    const char* pRow = reinterpret_cast<const char*>(sqlite3_column_text(s.GetStatementHandle(), 0));
+
+#ifdef VSQLITE_DEBUG_COLUMN_VIEWS
+    // Debug builds hand out a statement-owned copy, poisoned on the next Step.
+    VSQLITE_CHECK(view.data() != pRow);
+    const std::string_view stale = view;
+    VSQLITE_CHECK(s.Fetch(view));
+    VSQLITE_CHECK(stale.data() != view.data());
+#else
+    VSQLITE_CHECK(view.data() == pRow);
+    VSQLITE_CHECK(s.Fetch(view));
+#endif
+
+    VSQLITE_CHECK(view == "second");
+
+}
+
+namespace {
+
+    struct Point {
+        std::int64_t X;
+        std::int64_t Y;
+    };
+
+}
+
+VSQLITE_MAP(Point, X, Y);
+
+VSQLITE_TEST(Statement, MappedStructsAmongOtherArguments) {
+
+    Database db = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    db.Execute("CREATE TABLE Points(Name TEXT, X INTEGER, Y INTEGER, Weight REAL);");
+
+    Statement insert = db.PrepareStatement("INSERT INTO Points VALUES (?, ?, ?, ?);", 0);
+    insert.Execute(std::string("a"), Point { 1, 2 }, 0.5);
+    insert.ExecuteRebind(std::string("b"), Point { 3, 4 }, 1.5);
+
+    Statement select = db.PrepareStatement("SELECT Name, X, Y, Weight FROM Points ORDER BY Name;", 0);
+
+    std::string name = { };
+    Point point = { };
+    double weight = 0.00;
+
+    VSQLITE_CHECK(select.Fetch(name, point, weight));
+    VSQLITE_CHECK((name == "a") && (point.X == 1) && (point.Y == 2) && (weight == 0.5));
+    VSQLITE_CHECK(select.Fetch(name, point, weight));
+    VSQLITE_CHECK((name == "b") && (point.X == 3) && (point.Y == 4) && (weight == 1.5));
+    VSQLITE_CHECK(!select.Fetch(name, point, weight));
+
+    Statement swapped = db.PrepareStatement("SELECT ?, ?, ?;", 0);
+    swapped.Bind(Point { 5, 6 }, 7);
+
+    std::int64_t last = 0;
+    VSQLITE_CHECK(swapped.Fetch(point, last));
+    VSQLITE_CHECK((point.X == 5) && (point.Y == 6) && (last == 7));
+
+}
+
+VSQLITE_TEST(Statement, RowsOfMappedStructAndScalar) {
+
+    Database db = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    db.Execute("CREATE TABLE Points(X INTEGER, Y INTEGER, Weight REAL);");
+
+    Statement insert = db.PrepareStatement("INSERT INTO Points VALUES (?, ?, ?);", 0);
+    insert.Execute(Point { 1, 2 }, 0.5);
+    insert.Execute(Point { 3, 4 }, 1.5);
+
+    Statement select = db.PrepareStatement("SELECT X, Y, Weight FROM Points ORDER BY X;", 0);
+
+    std::int32_t count = 0;
+    for (const auto& [point, weight] : select.Rows<Point, double>()) {
+        VSQLITE_CHECK(point.Y == (point.X + 1));
+        VSQLITE_CHECK(weight == (static_cast<double>(point.X) / 2.00));
+        ++count;
+    }
+
+    VSQLITE_CHECK(count == 2);
+
+    Statement one = db.PrepareStatement("SELECT ?1 + 10, ?2 + 10;", 0);
+    one.Bind(Point { 1, 2 });
+
+    Point point = { };
+    VSQLITE_CHECK(one.Fetch(point));
+    VSQLITE_CHECK((point.X == 11) && (point.Y == 12));
+
+}
\ No newline at end of file
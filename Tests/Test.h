@@ -0,0 +1,143 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#ifndef _VSQLITE_TESTS_TEST_H_
+#define _VSQLITE_TESTS_TEST_H_
+
+#include <Vsqlite/Database.h>
+#include <Vsqlite/Statement.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <filesystem>
+#include <system_error>
+#include <stdexcept>
+#include <cstdint>
+
+namespace Vsqlite::Tests {
+
+    using TestFunction = void (*)(void);
+
+    struct TestInfo {
+        std::string_view Name;
+        TestFunction Function;
+    };
+
+    /**
+     * Thrown by VSQLITE_CHECK when a check fails.
+     */
+    class CheckFailure : public std::runtime_error {
+
+    public:
+        CheckFailure(const std::string_view expression, const char* file, const std::int32_t line);
+
+    };
+
+    /**
+     * Returns the registered tests, in registration order.
+     *
+     * @returns A vector of TestInfo.
+     */
+    std::vector<TestInfo>& GetRegistry(void);
+
+    /**
+     * Registers a test.
+     *
+     * @param name Test name, in the form Suite.Case.
+     * @param function Test function.
+     * @returns true.
+     */
+    bool Register(const std::string_view name, const TestFunction function);
+
+    /**
+     * Represents a database file in the temporary directory that is deleted,
+     * together with its journal files, on construction and destruction.
+     */
+    class TemporaryFile {
+
+    private:
+        std::filesystem::path m_path;
+
+        void Remove(void) const;
+
+    public:
+        explicit TemporaryFile(const std::string_view name);
+
+        TemporaryFile(const TemporaryFile&) = delete;
+        virtual ~TemporaryFile(void);
+
+        TemporaryFile& operator= (const TemporaryFile&) = delete;
+
+        std::string GetPath(void) const;
+
+    };
+
+    inline CheckFailure::CheckFailure(const std::string_view expression, const char* file, const std::int32_t line)
+        : std::runtime_error(std::string(file) + ":" + std::to_string(line) + ": check failed: " + std::string(expression)) { }
+
+    inline std::vector<TestInfo>& GetRegistry() {
+        static std::vector<TestInfo> registry = { };
+        return registry;
+    }
+
+    inline bool Register(const std::string_view name, const TestFunction function) {
+        GetRegistry().push_back({ name, function });
+        return true;
+    }
+
+    inline TemporaryFile::TemporaryFile(const std::string_view name)
+        : m_path(std::filesystem::temp_directory_path() / ("vsqlite_test_" + std::string(name) + ".db")) {
+        this->Remove();
+    }
+
+    inline TemporaryFile::~TemporaryFile() {
+        this->Remove();
+    }
+
+    inline void TemporaryFile::Remove() const {
+        std::error_code ec = { };
+        for (const char* suffix : { "", "-journal", "-wal", "-shm" })
+            std::filesystem::remove((this->m_path.string() + suffix), ec);
+    }
+
+    inline std::string TemporaryFile::GetPath() const {
+        return this->m_path.string();
+    }
+
+}
+
+/**
+ * Defines and registers a test function.
+ *
+ * @param suite Suite name.
+ * @param name Test name.
+ */
+#define VSQLITE_TEST(suite, name)                                                                           \
+    static void suite##_##name(void);                                                                       \
+    static const bool suite##_##name##Registered = Vsqlite::Tests::Register(#suite "." #name, &suite##_##name); \
+    static void suite##_##name(void)
+
+/**
+ * Fails the current test if the expression is false.
+ */
+#define VSQLITE_CHECK(expression)                                                                           \
+    do {                                                                                                    \
+        if (!(expression)) throw Vsqlite::Tests::CheckFailure(#expression, __FILE__, __LINE__);             \
+    } while (false)
+
+/**
+ * Fails the current test unless the expression throws an exception of the given type.
+ */
+#define VSQLITE_CHECK_THROWS(expression, exception)                                                         \
+    do {                                                                                                    \
+        bool thrown = false;                                                                                \
+        try { static_cast<void>(expression); }                                                              \
+        catch (const exception&) { thrown = true; }                                                         \
+        if (!thrown) throw Vsqlite::Tests::CheckFailure(#expression " throws " #exception, __FILE__, __LINE__); \
+    } while (false)
+
+#endif // _VSQLITE_TESTS_TEST_H_
\ No newline at end of file
@@ -0,0 +1,185 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#include "Test.h"
+
+#include <Vsqlite/Transaction.h>
+
+#include <chrono>
+#include <thread>
+#include <stdexcept>
+#include <cstdint>
+
+using namespace Vsqlite;
+using namespace Vsqlite::Tests;
+
+namespace {
+
+    std::int64_t Sum(Database& db) {
+        std::int64_t sum = -1;
+        db.Execute("SELECT coalesce(sum(Value), 0) FROM t;").Fetch(sum);
+        return sum;
+    }
+
+}
+
+VSQLITE_TEST(Transaction, NestedSavepointRollsBackOnlyItself) {
+
+    Database db = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    db.Execute("CREATE TABLE t(Value INTEGER);");
+
+    Transaction transaction = { db };
+    db.Execute("INSERT INTO t VALUES (1);");
+
+    {
+        Savepoint outer = { db };
+        db.Execute("INSERT INTO t VALUES (10);");
+
+        {
+            // Same name as the outer savepoint: ROLLBACK TO and RELEASE target the innermost one.
+            Savepoint inner = { db };
+            db.Execute("INSERT INTO t VALUES (100);");
+            inner.Rollback();
+            VSQLITE_CHECK(!inner.IsActive());
+        }
+
+        {
+            Savepoint inner = { db };
+            db.Execute("INSERT INTO t VALUES (1000);");
+        }
+
+        db.Execute("INSERT INTO t VALUES (10000);");
+        outer.Release();
+    }
+
+    transaction.Commit();
+    VSQLITE_CHECK(Sum(db) == 10011);
+
+}
+
+VSQLITE_TEST(Transaction, SavepointOutsideTransactionEndsIt) {
+
+    Database db = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    db.Execute("CREATE TABLE t(Value INTEGER);");
+
+    {
+        Savepoint savepoint = { db };
+        VSQLITE_CHECK(sqlite3_get_autocommit(db.GetDatabaseHandle()) == 0);
+        db.Execute("INSERT INTO t VALUES (1);");
+        savepoint.Rollback();
+    }
+
+    // ROLLBACK TO alone would leave the transaction open; the RELEASE that follows ends it.
+    VSQLITE_CHECK(sqlite3_get_autocommit(db.GetDatabaseHandle()) != 0);
+    VSQLITE_CHECK(Sum(db) == 0);
+
+    {
+        Savepoint savepoint = { db };
+        db.Execute("INSERT INTO t VALUES (2);");
+        savepoint.Release();
+    }
+
+    VSQLITE_CHECK(sqlite3_get_autocommit(db.GetDatabaseHandle()) != 0);
+    VSQLITE_CHECK(Sum(db) == 2);
+
+    Savepoint savepoint = { db };
+    savepoint.Release();
+    VSQLITE_CHECK_THROWS(savepoint.Release(), std::logic_error);
+    VSQLITE_CHECK_THROWS(savepoint.Rollback(), std::logic_error);
+
+}
+
+VSQLITE_TEST(Transaction, SavepointNameIsQuoted) {
+
+    Database db = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    db.Execute("CREATE TABLE t(Value INTEGER);");
+
+    {
+        Savepoint outer = { db, "outer \"name\"; DROP TABLE t" };
+        db.Execute("INSERT INTO t VALUES (1);");
+
+        Savepoint inner = { db, "inner\"" };
+        db.Execute("INSERT INTO t VALUES (2);");
+        inner.Rollback();
+
+        outer.Release();
+    }
+
+    VSQLITE_CHECK(Sum(db) == 1);
+    VSQLITE_CHECK_THROWS(Savepoint(db, ""), std::invalid_argument);
+
+}
+
+VSQLITE_TEST(Transaction, CommitAndRollbackRequireActiveTransaction) {
+
+    Database db = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+
+    Transaction transaction = { db };
+    transaction.Commit();
+
+    VSQLITE_CHECK(!transaction.IsActive());
+    VSQLITE_CHECK_THROWS(transaction.Commit(), std::logic_error);
+    VSQLITE_CHECK_THROWS(transaction.Rollback(), std::logic_error);
+
+}
+
+VSQLITE_TEST(Transaction, RetryPolicyRetriesOnlyBusy) {
+
+    const RetryPolicy policy = { .MaxAttempts = 3, .InitialDelay = std::chrono::microseconds(10) };
+
+    std::int32_t attempts = 0;
+    const std::int32_t result = policy.Run([&attempts] () {
+        if (++attempts < 3) throw SqliteException("database is locked", SQLITE_BUSY, SQLITE_BUSY);
+        return 42;
+    });
+
+    VSQLITE_CHECK(result == 42);
+    VSQLITE_CHECK(attempts == 3);
+
+    attempts = 0;
+    VSQLITE_CHECK_THROWS(policy.Run([&attempts] () {
+        ++attempts;
+        throw SqliteException("database is locked", SQLITE_BUSY, SQLITE_BUSY);
+    }), SqliteException);
+    VSQLITE_CHECK(attempts == 3);
+
+    attempts = 0;
+    VSQLITE_CHECK_THROWS(policy.Run([&attempts] () {
+        ++attempts;
+        throw SqliteException("constraint failed", SQLITE_CONSTRAINT, SQLITE_CONSTRAINT_UNIQUE);
+    }), SqliteException);
+    VSQLITE_CHECK(attempts == 1);
+
+    VSQLITE_CHECK(RetryPolicy().MaxAttempts > 1);
+
+}
+
+VSQLITE_TEST(Transaction, BeginRetriesWhileDatabaseIsLocked) {
+
+    const TemporaryFile file = TemporaryFile("transaction_retry");
+    Database db = { file.GetPath(), (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    Database other = { file.GetPath(), SQLITE_OPEN_READWRITE };
+    db.Execute("CREATE TABLE t(Value INTEGER);");
+
+    other.Execute("BEGIN IMMEDIATE;");
+
+    // Without a busy timeout BEGIN IMMEDIATE fails at once, and a single attempt gives up.
+    VSQLITE_CHECK_THROWS(Transaction(db, TransactionMode::Immediate, RetryPolicy { .MaxAttempts = 1 }), SqliteException);
+
+    std::thread releaser = std::thread([&other] () {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        other.Execute("COMMIT;");
+    });
+
+    const RetryPolicy policy = { .MaxAttempts = 1000, .InitialDelay = std::chrono::milliseconds(1), .MaxDelay = std::chrono::milliseconds(5) };
+    Transaction transaction = { db, TransactionMode::Immediate, policy };
+    db.Execute("INSERT INTO t VALUES (1);");
+    transaction.Commit();
+
+    releaser.join();
+    VSQLITE_CHECK(Sum(db) == 1);
+
+}
\ No newline at end of file
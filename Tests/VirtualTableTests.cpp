@@ -0,0 +1,112 @@
+/*
+    Vsqlite
+    Copyright (c) 2025 V0idPointer
+    Licensed under the MIT License
+*/
+
+#include "Test.h"
+
+#include <Vsqlite/RowMapping.h>
+#include <Vsqlite/VirtualTable.h>
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <cstdint>
+
+using namespace Vsqlite;
+using namespace Vsqlite::Tests;
+
+namespace {
+
+    struct Item {
+        std::int64_t Value;
+    };
+
+    std::int64_t Count(Database& db, const std::string& sql) {
+        std::int64_t count = 0;
+        db.Execute(sql).Fetch(count);
+        return count;
+    }
+
+}
+
+VSQLITE_MAP(Item, Value);
+
+VSQLITE_TEST(VirtualTable, CollatedConstraintsMatchRegularTable) {
+
+    const std::map<std::string, Item> items = {
+        { "ABC", { 1 } },
+        { "Apple", { 2 } },
+        { "abc", { 3 } },
+        { "b", { 4 } },
+    };
+
+    Database db = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    db.RegisterVirtualTable("items", items);
+    db.Execute("CREATE TABLE t(Key TEXT, Value INTEGER);");
+
+    Statement insert = db.PrepareStatement("INSERT INTO t VALUES (?, ?);", 0);
+    for (const auto& [key, item] : items) insert.Execute(key, item.Value);
+
+    const std::string_view conditions[] = {
+        "Key = 'abc'",
+        "Key = 'abc' COLLATE NOCASE",
+        "Key >= 'a'",
+        "Key >= 'a' COLLATE NOCASE",
+        "Key < 'b' COLLATE NOCASE",
+        "Key > 'ABC' COLLATE NOCASE AND Key <= 'b' COLLATE NOCASE",
+    };
+
+    for (const std::string_view condition : conditions) {
+        const std::string where = (" WHERE " + std::string(condition) + ";");
+        VSQLITE_CHECK(Count(db, ("SELECT count(*) FROM items" + where)) == Count(db, ("SELECT count(*) FROM t" + where)));
+    }
+
+    VSQLITE_CHECK(Count(db, "SELECT count(*) FROM items WHERE Key = 'abc' COLLATE NOCASE;") == 2);
+    VSQLITE_CHECK(Count(db, "SELECT count(*) FROM items WHERE Key >= 'a' COLLATE NOCASE;") == 4);
+
+}
+
+VSQLITE_TEST(VirtualTable, RowidDoesNotDependOnPlan) {
+
+    const std::map<std::string, Item> ordered = { { "a", { 1 } }, { "b", { 2 } }, { "c", { 3 } } };
+    const std::unordered_map<std::int64_t, Item> unordered = { { 10, { 1 } }, { 20, { 2 } }, { 30, { 3 } } };
+    const std::vector<Item> vector = { { 1 }, { 2 }, { 3 } };
+
+    Database db = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    db.RegisterVirtualTable("ordered", ordered);
+    db.RegisterVirtualTable("unordered", unordered);
+    db.RegisterVirtualTable("vector", vector);
+
+    VSQLITE_CHECK(Count(db, "SELECT rowid FROM ordered WHERE Key = 'c';") == 2);
+    VSQLITE_CHECK(Count(db, "SELECT rowid FROM ordered WHERE Key > 'b';") == 2);
+    VSQLITE_CHECK(Count(db, "SELECT rowid FROM ordered WHERE Value = 3;") == 2);
+
+    const std::int64_t scanned = Count(db, "SELECT rowid FROM unordered WHERE Value = 2;");
+    VSQLITE_CHECK(Count(db, "SELECT rowid FROM unordered WHERE Key = 20;") == scanned);
+
+    VSQLITE_CHECK(Count(db, "SELECT rowid FROM vector WHERE rowid = 1;") == 1);
+    VSQLITE_CHECK(Count(db, "SELECT rowid FROM vector WHERE rowid >= 2;") == 2);
+    VSQLITE_CHECK(Count(db, "SELECT rowid FROM vector WHERE Value = 3;") == 2);
+
+}
+
+VSQLITE_TEST(VirtualTable, LookupsMatchScans) {
+
+    std::map<std::int64_t, Item> items = { };
+    for (std::int64_t i = 0; i < 100; ++i) items.emplace((i * 3), Item { i });
+
+    Database db = { ":memory:", (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) };
+    db.RegisterVirtualTable("items", items);
+
+    VSQLITE_CHECK(Count(db, "SELECT count(*) FROM items WHERE Key = 30;") == 1);
+    VSQLITE_CHECK(Count(db, "SELECT count(*) FROM items WHERE Key = 31;") == 0);
+    VSQLITE_CHECK(Count(db, "SELECT count(*) FROM items WHERE Key = '30';") == 1);
+    VSQLITE_CHECK(Count(db, "SELECT count(*) FROM items WHERE Key >= 30 AND Key < 60;") == 10);
+    VSQLITE_CHECK(Count(db, "SELECT count(*) FROM items WHERE Key > 60 AND Key < 30;") == 0);
+    VSQLITE_CHECK(Count(db, "SELECT sum(b.Value) FROM items AS a JOIN items AS b ON b.Key = (a.Key * 2) WHERE a.Key < 30;") == 90);
+
+}
\ No newline at end of file